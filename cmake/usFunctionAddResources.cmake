@@ -9,7 +9,7 @@
 #
 #    usFunctionAddResources(TARGET target [BUNDLE_NAME bundle_name]
 #      [WORKING_DIRECTORY dir] [COMPRESSION_LEVEL level]
-#      [FILES res1...] [ZIP_ARCHIVES archive1...])
+#      [COMPRESSION_RULES rule1...] [FILES res1...] [ZIP_ARCHIVES archive1...])
 #
 # This CMake function uses an external command line program to generate a ZIP archive
 # containing data from external resources such as text files or images or other ZIP
@@ -46,6 +46,10 @@
 #      current CMake source directory.
 #
 # **Multi-value keywords**
+#    * ``COMPRESSION_RULES`` (optional): A list of ``<pattern>=<level>`` rules which override
+#      ``COMPRESSION_LEVEL`` for resource files matching the glob pattern, e.g. ``*.png=0``
+#      to store images uncompressed. The first matching rule applies. Files which do not
+#      get smaller when compressed are always stored uncompressed.
 #    * ``FILES`` (optional): A list of resource files (paths to external files in the file system)
 #      relative to the current working directory.
 #    * ``ZIP_ARCHIVES`` (optional): A list of zip archives (relative to the current working directory
@@ -60,7 +64,7 @@
 #
 function(usFunctionAddResources)
 
-  cmake_parse_arguments(US_RESOURCE "" "TARGET;BUNDLE_NAME;WORKING_DIRECTORY;COMPRESSION_LEVEL" "FILES;ZIP_ARCHIVES" ${ARGN})
+  cmake_parse_arguments(US_RESOURCE "" "TARGET;BUNDLE_NAME;WORKING_DIRECTORY;COMPRESSION_LEVEL" "COMPRESSION_RULES;FILES;ZIP_ARCHIVES" ${ARGN})
 
   if(NOT US_RESOURCE_TARGET)
     message(SEND_ERROR "TARGET argument not specified.")
@@ -88,6 +92,9 @@ function(usFunctionAddResources)
   if(US_RESOURCE_COMPRESSION_LEVEL)
     set(cmd_line_args -c ${US_RESOURCE_COMPRESSION_LEVEL})
   endif()
+  foreach(_rule ${US_RESOURCE_COMPRESSION_RULES})
+    list(APPEND cmd_line_args -R ${_rule})
+  endforeach()
 
   if(CMAKE_CROSSCOMPILING)
     # Cross-compiled builds need to use the imported host version of usResourceCompiler
@@ -9,7 +9,7 @@
 #
 #    usFunctionEmbedResources(TARGET target [BUNDLE_NAME bundle_name] [APPEND | LINK]
 #      [WORKING_DIRECTORY dir] [COMPRESSION_LEVEL level]
-#      [FILES res1...] [ZIP_ARCHIVES archive1...])
+#      [COMPRESSION_RULES rule1...] [FILES res1...] [ZIP_ARCHIVES archive1...])
 #
 # This CMake function uses an external command line program to generate a ZIP archive
 # containing data from external resources such as text files or images or other ZIP
@@ -53,8 +53,9 @@
 #    * ``APPEND``: Append the resources zip file to the target file.
 #    * ``LINK``: Link (embed) the resources zip file if possible.
 #
-# For the ``WORKING_DIRECTORY``, ``COMPRESSION_LEVEL``, ``FILES``, ``ZIP_ARCHIVES`` parameters see the
-# documentation of the usFunctionAddResources macro which is called with these parameters if set.
+# For the ``WORKING_DIRECTORY``, ``COMPRESSION_LEVEL``, ``COMPRESSION_RULES``, ``FILES``, ``ZIP_ARCHIVES``
+# parameters see the documentation of the usFunctionAddResources macro which is called with these
+# parameters if set.
 #
 # .. seealso::
 #
@@ -64,7 +65,7 @@
 #
 function(usFunctionEmbedResources)
 
-  cmake_parse_arguments(US_RESOURCE "APPEND;LINK" "TARGET;BUNDLE_NAME;WORKING_DIRECTORY;COMPRESSION_LEVEL" "FILES;ZIP_ARCHIVES" ${ARGN})
+  cmake_parse_arguments(US_RESOURCE "APPEND;LINK" "TARGET;BUNDLE_NAME;WORKING_DIRECTORY;COMPRESSION_LEVEL" "COMPRESSION_RULES;FILES;ZIP_ARCHIVES" ${ARGN})
 
   if(NOT US_RESOURCE_TARGET)
     message(SEND_ERROR "TARGET argument not specified.")
@@ -75,6 +76,7 @@ function(usFunctionEmbedResources)
       BUNDLE_NAME ${US_RESOURCE_BUNDLE_NAME}
       WORKING_DIRECTORY ${US_RESOURCE_WORKING_DIRECTORY}
       COMPRESSION_LEVEL ${US_RESOURCE_COMPRESSION_LEVEL}
+      COMPRESSION_RULES ${US_RESOURCE_COMPRESSION_RULES}
       FILES ${US_RESOURCE_FILES}
       ZIP_ARCHIVES ${US_RESOURCE_ZIP_ARCHIVES}
     )
@@ -50,7 +50,9 @@ namespace cppmicroservices
             // manually
             for (auto const& bundle : context.GetBundles())
             {
-                if (cppmicroservices::Bundle::State::STATE_ACTIVE & bundle.GetState())
+                // bundles waiting for lazy activation are in the STARTING state
+                if ((cppmicroservices::Bundle::State::STATE_ACTIVE | cppmicroservices::Bundle::State::STATE_STARTING)
+                    & bundle.GetState())
                 {
                     cppmicroservices::BundleEvent evt(cppmicroservices::BundleEvent::BUNDLE_STARTED, bundle);
                     BundleChanged(evt);
@@ -177,8 +179,9 @@ namespace cppmicroservices
                 return;
             }
 
-            // TODO: revisit to include LAZY_ACTIVATION when supported by the framework
-            if (cppmicroservices::BundleEvent::BUNDLE_STARTED & eventType)
+            // a lazily started bundle gets its configuration before its activator runs
+            if ((cppmicroservices::BundleEvent::BUNDLE_STARTED | cppmicroservices::BundleEvent::BUNDLE_LAZY_ACTIVATION)
+                & eventType)
             {
                 CreateExtension(bundle);
             }
@@ -27,6 +27,7 @@
 #include "cppmicroservices/Constants.h"
 #include "cppmicroservices/cm/ConfigurationException.hpp"
 #include "cppmicroservices/detail/ScopeGuard.h"
+#include "cppmicroservices/detail/Trace.h"
 
 #include "CMConstants.hpp"
 #include "ConfigurationAdminImpl.hpp"
@@ -1054,6 +1055,7 @@ namespace cppmicroservices
                                 futuresCV.notify_one();
                             }
                         });
+                    detail::TraceSpan span("configadmin", "PerformAsync");
                     func();
                 });
 
@@ -265,9 +265,9 @@ namespace cppmicroservices
             {
                 throw ComponentException("Context is invalid");
             }
-            auto boundServicesCacheHandle = boundServicesCache.lock();
-            auto serviceMapItr = boundServicesCacheHandle->find(name);
-            if (serviceMapItr != boundServicesCacheHandle->end())
+            auto const boundServices = GetBoundServicesSnapshot();
+            auto serviceMapItr = boundServices->find(name);
+            if (serviceMapItr != boundServices->end())
             {
                 auto& serviceMaps = serviceMapItr->second;
                 if (!serviceMaps.empty())
@@ -289,9 +289,9 @@ namespace cppmicroservices
                 throw ComponentException("Context is invalid");
             }
             std::vector<std::shared_ptr<void>> services;
-            auto boundServicesCacheHandle = boundServicesCache.lock();
-            auto serviceMapItr = boundServicesCacheHandle->find(name);
-            if (serviceMapItr != boundServicesCacheHandle->end())
+            auto const boundServices = GetBoundServicesSnapshot();
+            auto serviceMapItr = boundServices->find(name);
+            if (serviceMapItr != boundServices->end())
             {
                 auto& serviceMaps = serviceMapItr->second;
                 std::for_each(serviceMaps.begin(),
@@ -305,6 +305,29 @@ namespace cppmicroservices
             return services;
         }
 
+        std::shared_ptr<ComponentContextImpl::BoundServicesMap const>
+        ComponentContextImpl::GetBoundServicesSnapshot() const
+        {
+            auto snapshot = std::atomic_load(&boundServicesSnapshot);
+            if (!snapshot)
+            {
+                auto boundServicesCacheHandle = boundServicesCache.lock();
+                snapshot = std::atomic_load(&boundServicesSnapshot);
+                if (!snapshot)
+                {
+                    snapshot = std::make_shared<BoundServicesMap const>(*boundServicesCacheHandle);
+                    std::atomic_store(&boundServicesSnapshot, snapshot);
+                }
+            }
+            return snapshot;
+        }
+
+        void
+        ComponentContextImpl::InvalidateBoundServicesSnapshot()
+        {
+            std::atomic_store(&boundServicesSnapshot, std::shared_ptr<BoundServicesMap const>());
+        }
+
         cppmicroservices::BundleContext
         ComponentContextImpl::GetBundleContext() const
         {
@@ -383,6 +406,7 @@ namespace cppmicroservices
             configManager = std::weak_ptr<ComponentConfiguration>();
             auto boundServicesCacheHandle = boundServicesCache.lock();
             boundServicesCacheHandle->clear();
+            InvalidateBoundServicesSnapshot();
         }
 
         bool
@@ -398,6 +422,7 @@ namespace cppmicroservices
                 return false;
             }
             (*boundServicesCacheHandle)[refName].emplace_back(interfaceMap);
+            InvalidateBoundServicesSnapshot();
             return true;
         }
 
@@ -428,7 +453,7 @@ namespace cppmicroservices
                                                          == servicesMap->at(serviceInterface));
                                           }),
                            services.end());
-            return;
+            InvalidateBoundServicesSnapshot();
         }
 
     } // namespace scrimpl
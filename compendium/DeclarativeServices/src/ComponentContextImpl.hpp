@@ -220,10 +220,25 @@ namespace cppmicroservices
 
             void InitializeServicesCache();
 
+            using BoundServicesMap = std::unordered_map<std::string, std::vector<cppmicroservices::InterfaceMapConstPtr>>;
+
+            /**
+             * Returns an immutable copy of #boundServicesCache. The copy is shared
+             * by all lookups until the cache changes, so the common
+             * LocateService(s) path takes no lock.
+             */
+            std::shared_ptr<BoundServicesMap const> GetBoundServicesSnapshot() const;
+
+            /**
+             * Drops the snapshot returned by #GetBoundServicesSnapshot. Must be
+             * called with the lock on #boundServicesCache held, after modifying it.
+             */
+            void InvalidateBoundServicesSnapshot();
+
             std::weak_ptr<ComponentConfiguration> configManager;
             cppmicroservices::Bundle usingBundle;
-            mutable Guarded<std::unordered_map<std::string, std::vector<cppmicroservices::InterfaceMapConstPtr>>>
-                boundServicesCache;
+            mutable Guarded<BoundServicesMap> boundServicesCache;
+            mutable std::shared_ptr<BoundServicesMap const> boundServicesSnapshot; ///< accessed atomically
         };
     } // namespace scrimpl
 } // namespace cppmicroservices
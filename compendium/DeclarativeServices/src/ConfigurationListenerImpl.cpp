@@ -89,7 +89,7 @@ namespace cppmicroservices
                     {
                         return;
                     }
-                    auto ptr = std::make_shared<cppmicroservices::AnyMap>(properties);
+                    auto ptr = std::make_shared<cppmicroservices::AnyMap>(std::move(properties));
                     configNotifier->NotifyAllListeners(pid, type, ptr, changeCount);
                 }
                 catch (cppmicroservices::SecurityException const&)
@@ -77,7 +77,9 @@ namespace cppmicroservices
             // manually
             for (auto const& bundle : context.GetBundles())
             {
-                if (bundle.GetState() & cppmicroservices::Bundle::State::STATE_ACTIVE)
+                // bundles waiting for lazy activation are in the STARTING state
+                if (bundle.GetState()
+                    & (cppmicroservices::Bundle::State::STATE_ACTIVE | cppmicroservices::Bundle::State::STATE_STARTING))
                 {
                     cppmicroservices::BundleEvent evt(cppmicroservices::BundleEvent::BUNDLE_STARTED, bundle);
                     BundleChanged(evt);
@@ -214,8 +216,10 @@ namespace cppmicroservices
                 return;
             }
 
-            // TODO: revisit to include LAZY_ACTIVATION when supported by the framework
-            if (eventType & cppmicroservices::BundleEvent::BUNDLE_STARTED)
+            // a lazily started bundle gets its components before its activator runs
+            if (eventType
+                & (cppmicroservices::BundleEvent::BUNDLE_STARTED
+                   | cppmicroservices::BundleEvent::BUNDLE_LAZY_ACTIVATION))
             {
                 CreateExtension(bundle);
             }
@@ -25,11 +25,13 @@
 #include "cppmicroservices/SharedLibraryException.h"
 #include "cppmicroservices/cm/ConfigurationAdmin.hpp"
 #include "cppmicroservices/servicecomponent/ComponentConstants.hpp"
+#include "manager/BundleLoader.hpp"
 #include "manager/ComponentManagerImpl.hpp"
 #include "manager/ConfigurationNotifier.hpp"
 #include "metadata/ComponentMetadata.hpp"
 #include "metadata/MetadataParser.hpp"
 #include "metadata/MetadataParserFactory.hpp"
+#include "metadata/PrecompiledMetadata.hpp"
 #include "metadata/Util.hpp"
 
 using cppmicroservices::service::component::ComponentConstants::SERVICE_COMPONENT;
@@ -69,9 +71,23 @@ namespace cppmicroservices
             }
 
             auto version = ObjectValidator(scrMetadata, "version").GetValue<int>();
-            auto metadataparser = metadata::MetadataParserFactory::Create(version, logger);
             std::vector<std::shared_ptr<ComponentMetadata>> componentsMetadata;
-            componentsMetadata = metadataparser->ParseAndGetComponentsMetadata(scrMetadata);
+            // Use the metadata precompiled by SCRCodeGen if the bundle binary is already
+            // loaded, otherwise parse the manifest.
+            if (auto const table = FindComponentMetadataTable(bundle_))
+            {
+                componentsMetadata = metadata::CreateComponentsMetadata(*table, scrMetadata);
+                if (!componentsMetadata.empty())
+                {
+                    logger->Log(cppmicroservices::logservice::SeverityLevel::LOG_DEBUG,
+                                "Using precompiled component metadata for " + bundle_.GetSymbolicName());
+                }
+            }
+            if (componentsMetadata.empty())
+            {
+                auto metadataparser = metadata::MetadataParserFactory::Create(version, logger);
+                componentsMetadata = metadataparser->ParseAndGetComponentsMetadata(scrMetadata);
+            }
             for (auto& oneCompMetadata : componentsMetadata)
             {
                 try
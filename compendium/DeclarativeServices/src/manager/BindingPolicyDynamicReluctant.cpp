@@ -52,7 +52,7 @@ namespace cppmicroservices
                 // If the service was previously satisfied then either there is
                 // nothing to do or a rebind needs to happen if the cardinality
                 // is optional and there are no bound refs.
-                if (0 == mgr.GetBoundReferences().size())
+                if (mgr.boundRefs.lock()->empty())
                 {
                     Log("Notify BIND for reference " + mgr.metadata_.name);
 
@@ -66,7 +66,7 @@ namespace cppmicroservices
                 // bound references is within limit of maxCardinality value
                 // otherwise log to the user that further bind is not possible
                 if (mgr.IsMultiple()) {
-                    if (mgr.GetBoundReferences().size() < mgr.metadata_.maxCardinality) {
+                    if (mgr.boundRefs.lock()->size() < mgr.metadata_.maxCardinality) {
                         Log("Notify BIND for reference " + mgr.metadata_.name);
 
                         ClearBoundRefs();
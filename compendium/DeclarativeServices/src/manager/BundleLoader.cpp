@@ -62,6 +62,16 @@ namespace cppmicroservices
                 return std::to_string(val);
 #endif
             }
+
+            // cannot use bundle id as key because id is reused when the framework is restarted.
+            // strings are not optimal but will work fine as long as a binary is not unloaded
+            // from the process.
+            Guarded<std::map<std::string, void*>>&
+            BundleBinaries()
+            {
+                static Guarded<std::map<std::string, void*>> bundleBinaries; ///< map of bundle location and handle pairs
+                return bundleBinaries;
+            }
         } // namespace
 
 #if defined(_WIN32)
@@ -92,10 +102,7 @@ namespace cppmicroservices
                                     cppmicroservices::Bundle const& fromBundle,
                                     std::shared_ptr<cppmicroservices::logservice::LogService> const& logger)
         {
-            // cannot use bundle id as key because id is reused when the framework is restarted.
-            // strings are not optimal but will work fine as long as a binary is not unloaded
-            // from the process.
-            static Guarded<std::map<std::string, void*>> bundleBinaries; ///< map of bundle location and handle pairs
+            auto& bundleBinaries = BundleBinaries();
             auto const bundleLoc = fromBundle.GetLocation();
 
             void* handle = nullptr;
@@ -188,5 +195,57 @@ namespace cppmicroservices
             return std::make_tuple(reinterpret_cast<ComponentInstance* (*)(void)>(newsym),  // NOLINT
                                    reinterpret_cast<void (*)(ComponentInstance*)>(delsym)); // NOLINT
         }
+
+        std::shared_ptr<ComponentMetadataTable const>
+        FindComponentMetadataTable(cppmicroservices::Bundle const& fromBundle)
+        {
+            auto const bundleLoc = fromBundle.GetLocation();
+            // The owner keeps the binary loaded while the table is in use. It does not own a
+            // reference if the handle was loaded by GetComponentCreatorDeletors.
+            std::shared_ptr<void> owner;
+            {
+                auto binaries = BundleBinaries().lock();
+                auto const binary = binaries->find(bundleLoc);
+                if (binary != binaries->end())
+                {
+                    owner = std::shared_ptr<void>(binary->second, [](void*) {});
+                }
+            }
+            if (!owner)
+            {
+#if defined(_WIN32)
+                // GetModuleHandleW does not increment the reference count of the module
+                void* handle = GetModuleHandleW(UTF8StrToWStr(bundleLoc).c_str());
+                if (handle != nullptr)
+                {
+                    owner = std::shared_ptr<void>(handle, [](void*) {});
+                }
+#else
+                // RTLD_NOLOAD only returns a handle if the binary is already loaded
+                void* handle = dlopen(bundleLoc.c_str(), RTLD_LAZY | RTLD_LOCAL | RTLD_NOLOAD);
+                if (handle != nullptr)
+                {
+                    owner = std::shared_ptr<void>(handle, [](void* h) { dlclose(h); });
+                }
+#endif
+            }
+            if (!owner)
+            {
+                return nullptr;
+            }
+
+            try
+            {
+                const std::string fname_table = US_STR(US_SCR_METADATA_TABLE_PREFIX) + fromBundle.GetSymbolicName();
+                auto const getTable = reinterpret_cast<GetComponentMetadataTableFn>( // NOLINT
+                    fromBundle.GetSymbol(owner.get(), fname_table));
+                auto const table = getTable ? getTable() : nullptr;
+                return table ? std::shared_ptr<ComponentMetadataTable const>(owner, table) : nullptr;
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+        }
     } // namespace scrimpl
 } // namespace cppmicroservices
@@ -26,9 +26,12 @@
 #include "ConcurrencyUtil.hpp"
 #include "cppmicroservices/logservice/LogService.hpp"
 #include "cppmicroservices/servicecomponent/detail/ComponentInstance.hpp"
+#include "cppmicroservices/servicecomponent/detail/ComponentMetadataTable.hpp"
 #include <map>
 
 using cppmicroservices::service::component::detail::ComponentInstance;
+using cppmicroservices::service::component::detail::ComponentMetadataTable;
+using cppmicroservices::service::component::detail::GetComponentMetadataTableFn;
 // typedef ComponentInstance*(*NewComponentInstanceFuncPtr)();
 // typedef void(*DeleteComponentInstanceFuncPtr)(ComponentInstance*);
 
@@ -55,6 +58,19 @@ namespace cppmicroservices
         GetComponentCreatorDeletors(std::string const& compName,
                                     cppmicroservices::Bundle const& fromBundle,
                                     std::shared_ptr<cppmicroservices::logservice::LogService> const& logger);
+
+        /**
+         * Method to find the component metadata table SCRCodeGen generated for the
+         * given {@link Bundle}. The bundle binary is never loaded by this method; the
+         * table is only found if the binary is already loaded into the process.
+         *
+         * \param fromBundle is the bundle whose table is returned
+         *
+         * \return the table, which keeps the bundle binary loaded while it is referenced,
+         *         or \c nullptr if the binary is not loaded or has no table.
+         */
+        std::shared_ptr<ComponentMetadataTable const> FindComponentMetadataTable(
+            cppmicroservices::Bundle const& fromBundle);
     } // namespace scrimpl
 } // namespace cppmicroservices
 #endif /* BUNDLELOADER_HPP */
@@ -31,6 +31,7 @@
 #include "ReferenceManagerImpl.hpp"
 #include "RegistrationManager.hpp"
 #include "boost/asio/post.hpp"
+#include "cppmicroservices/detail/Trace.h"
 #include "cppmicroservices/servicecomponent/ComponentConstants.hpp"
 #include "states/CCUnsatisfiedReferenceState.hpp"
 #include "states/ComponentConfigurationState.hpp"
@@ -135,7 +136,8 @@ namespace cppmicroservices
                 // If configuration object dependencies exist, use merged component and configuration object properties.
                 if (configManager != nullptr)
                 {
-                    for (auto const& item : configManager->GetProperties())
+                    auto const merged = configManager->GetPropertiesSnapshot();
+                    for (auto const& item : *merged)
                     {
                         props.emplace(item.first, item.second);
                     }
@@ -431,6 +433,7 @@ namespace cppmicroservices
         void
         ComponentConfigurationImpl::Register()
         {
+            detail::TraceSpan span("scr", "RegisterComponent", GetMetadata()->name);
             GetState()->Register(*this);
         }
 
@@ -477,6 +480,7 @@ namespace cppmicroservices
             if (newCompInstanceFunc == nullptr || deleteCompInstanceFunc == nullptr)
             {
                 auto instanceName = GetMetadata()->instanceName;
+                detail::TraceSpan span("scr", "LoadComponentLibrary", instanceName);
 
                 std::tie(newCompInstanceFunc, deleteCompInstanceFunc)
                     = GetComponentCreatorDeletors(instanceName, GetBundle(), logger);
@@ -493,6 +497,7 @@ namespace cppmicroservices
         InstanceContextPair
         ComponentConfigurationImpl::CreateAndActivateComponentInstanceHelper(cppmicroservices::Bundle const& bundle)
         {
+            detail::TraceSpan span("scr", "ActivateComponent", GetMetadata()->name);
             auto componentInstance = CreateComponentInstance();
             auto ctxt = std::make_shared<ComponentContextImpl>(shared_from_this(), bundle);
             /*
@@ -22,6 +22,10 @@
 
 #include "ConfigurationManager.hpp"
 #include "cppmicroservices/servicecomponent/ComponentConstants.hpp"
+
+#include <memory>
+#include <vector>
+
 using cppmicroservices::service::component::ComponentConstants::CONFIG_POLICY_IGNORE;
 using cppmicroservices::service::component::ComponentConstants::CONFIG_POLICY_REQUIRE;
 
@@ -35,7 +39,8 @@ namespace cppmicroservices
             : logger(std::move(logger))
             , metadata(metadata)
             , bundleContext(bc)
-            , mergedProperties(metadata->properties)
+            , metadataProperties(std::make_shared<cppmicroservices::AnyMap const>(metadata->properties))
+            , mergedProperties(metadataProperties)
         {
             if (!this->metadata || !this->bundleContext || !this->logger)
             {
@@ -46,9 +51,48 @@ namespace cppmicroservices
         cppmicroservices::AnyMap
         ConfigurationManager::GetProperties() const noexcept
         {
-            std::lock_guard<std::mutex> lock(propertiesMutex);
+            return *GetPropertiesSnapshot();
+        }
+
+        std::shared_ptr<cppmicroservices::AnyMap const>
+        ConfigurationManager::GetPropertiesSnapshot() const noexcept
+        {
+            return std::atomic_load(&mergedProperties);
+        }
+
+        void
+        ConfigurationManager::publishMergedProperties()
+        {
+            //  merge the properties maintaining precedence as follows:
+            //  lowest precedence properties from the metadata
+            //  next precedence each pid in meta-data configuration-pids with first one
+            //  in the list having lower precedence than the last one in the list.
+            //  Without configuration objects the metadata properties are shared as is.
+            std::vector<cppmicroservices::AnyMap const*> overlays;
+            for (auto const& pid : metadata->configurationPids)
+            {
+                auto it = configProperties.find(pid);
+                if (it != configProperties.end() && it->second && !it->second->empty())
+                {
+                    overlays.push_back(it->second.get());
+                }
+            }
+
+            if (overlays.empty())
+            {
+                std::atomic_store(&mergedProperties, metadataProperties);
+                return;
+            }
 
-            return mergedProperties;
+            auto merged = std::make_shared<cppmicroservices::AnyMap>(*metadataProperties);
+            for (auto const* overlay : overlays)
+            {
+                for (auto const& item : *overlay)
+                {
+                    (*merged)[item.first] = item.second;
+                }
+            }
+            std::atomic_store(&mergedProperties, std::shared_ptr<cppmicroservices::AnyMap const>(std::move(merged)));
         }
 
         void
@@ -74,15 +118,13 @@ namespace cppmicroservices
                         if (config.size() > 0)
                         {
                             changeCount[pid] = config.front()->GetChangeCount();
-                            auto properties = config.front()->GetProperties();
-                            configProperties.emplace(pid, properties);
-                            for (auto const& item : properties)
-                            {
-                                mergedProperties[item.first] = item.second;
-                            }
+                            configProperties.emplace(
+                                pid,
+                                std::make_shared<cppmicroservices::AnyMap const>(config.front()->GetProperties()));
                         }
                     }
                 }
+                publishMergedProperties();
             }
             catch (...)
             {
@@ -107,7 +149,9 @@ namespace cppmicroservices
             std::lock_guard<std::mutex> lock(propertiesMutex);
             configWasSatisfied = isConfigSatisfied();
 
-            // delete properties for this pid or replace with new properties in configProperties
+            // delete properties for this pid or replace with new properties in configProperties.
+            // The notification's properties are not modified after they are sent, so they are
+            // shared instead of copied.
 
             auto it = configProperties.find(pid);
             if (it != configProperties.end())
@@ -116,33 +160,16 @@ namespace cppmicroservices
             }
             if (type == cppmicroservices::service::cm::ConfigurationEventType::CM_UPDATED)
             {
-                configProperties.emplace(pid, *props);
+                configProperties.emplace(pid, std::move(props));
             }
 
-            //  recalculate the merged properties maintaining precedence as follows:
-            //  lowest precedence properties from the metadata
-            //  next precedence each pid in meta-data configuration-pids with first one
-            //  in the list having lower precedence than the last one in the list.
-
             if (newChangeCount != changeCount[pid])
             {
                 changeCountDifferent = true;
                 changeCount[pid] = newChangeCount;
             }
 
-            mergedProperties = metadata->properties;
-
-            for (auto const& pid : metadata->configurationPids)
-            {
-                auto it = configProperties.find(pid);
-                if (it != configProperties.end())
-                {
-                    for (auto const& item : it->second)
-                    {
-                        mergedProperties[item.first] = item.second;
-                    }
-                }
-            }
+            publishMergedProperties();
 
             configNowSatisfied = isConfigSatisfied();
         }
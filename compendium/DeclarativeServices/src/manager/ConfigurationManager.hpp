@@ -92,16 +92,31 @@ namespace cppmicroservices
              */
             cppmicroservices::AnyMap GetProperties() const noexcept;
 
+            /* Returns the current merged properties without copying them. The
+             * returned map is never modified; a configuration change publishes
+             * a new map instead.
+             */
+            std::shared_ptr<cppmicroservices::AnyMap const> GetPropertiesSnapshot() const noexcept;
+
           private:
             bool isConfigSatisfied() const noexcept;
 
+            /* Merges the metadata properties and the configuration object
+             * properties, in the precedence order of metadata->configurationPids,
+             * and publishes the result. Must be called with propertiesMutex held.
+             */
+            void publishMergedProperties();
+
             std::shared_ptr<cppmicroservices::logservice::LogService> logger; ///< logger for this runtime
             std::shared_ptr<metadata::ComponentMetadata const> const metadata;
             cppmicroservices::BundleContext bundleContext; ///< context of the bundle which contains the component
-            mutable std::mutex propertiesMutex; // mutex to protect the configProperties and mergedProperties members
-            std::unordered_map<std::string, cppmicroservices::AnyMap>
+            mutable std::mutex propertiesMutex; // mutex to protect the configProperties and changeCount members
+            std::unordered_map<std::string, std::shared_ptr<cppmicroservices::AnyMap const>>
                 configProperties; // properties for available configuration objects.
-            cppmicroservices::AnyMap mergedProperties;
+            std::shared_ptr<cppmicroservices::AnyMap const>
+                metadataProperties; // component properties from the metadata, shared by every merged map
+            std::shared_ptr<cppmicroservices::AnyMap const>
+                mergedProperties; // accessed with std::atomic_load/std::atomic_store
             std::unordered_map<std::string, unsigned long> changeCount;
         };
     } // namespace scrimpl
@@ -0,0 +1,141 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+  =============================================================================*/
+
+#include "RankedReferences.hpp"
+
+#include "cppmicroservices/Constants.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace cppmicroservices
+{
+    namespace scrimpl
+    {
+
+        namespace
+        {
+            bool
+            GetRankAndId(ServiceReferenceBase const& ref, int& ranking, long& id)
+            {
+                if (!ref)
+                {
+                    return false;
+                }
+                auto const idAny = ref.GetProperty(Constants::SERVICE_ID);
+                if (idAny.Empty())
+                {
+                    return false;
+                }
+                auto const rankingAny = ref.GetProperty(Constants::SERVICE_RANKING);
+                id = any_cast<long>(idAny);
+                ranking = rankingAny.Empty() ? 0 : any_cast<int>(rankingAny);
+                return true;
+            }
+
+            long
+            GetId(ServiceReferenceBase const& ref)
+            {
+                if (!ref)
+                {
+                    return 0;
+                }
+                auto const idAny = ref.GetProperty(Constants::SERVICE_ID);
+                return idAny.Empty() ? 0 : any_cast<long>(idAny);
+            }
+        } // namespace
+
+        std::vector<RankedReferences::RankKey>::const_iterator
+        RankedReferences::FindKey(long id) const
+        {
+            auto const ranking = rankingById.find(id);
+            if (ranking == rankingById.end())
+            {
+                return keys.end();
+            }
+            auto const key = MakeKey(ranking->second, id);
+            auto const pos = std::lower_bound(keys.begin(), keys.end(), key);
+            return (pos != keys.end() && *pos == key) ? pos : keys.end();
+        }
+
+        bool
+        RankedReferences::insert(ServiceReferenceBase const& ref)
+        {
+            int ranking = 0;
+            long id = 0;
+            if (!GetRankAndId(ref, ranking, id) || !rankingById.emplace(id, ranking).second)
+            {
+                return false;
+            }
+            auto const key = MakeKey(ranking, id);
+            auto const pos = std::lower_bound(keys.begin(), keys.end(), key);
+            auto const offset = std::distance(keys.begin(), pos);
+            keys.insert(pos, key);
+            refs.insert(refs.begin() + offset, ref);
+            return true;
+        }
+
+        std::size_t
+        RankedReferences::erase(ServiceReferenceBase const& ref)
+        {
+            auto const id = GetId(ref);
+            auto const pos = FindKey(id);
+            if (pos == keys.end())
+            {
+                return 0;
+            }
+            auto const offset = std::distance(keys.cbegin(), pos);
+            keys.erase(pos);
+            refs.erase(refs.begin() + offset);
+            rankingById.erase(id);
+            return 1;
+        }
+
+        RankedReferences::const_iterator
+        RankedReferences::find(ServiceReferenceBase const& ref) const
+        {
+            auto const pos = FindKey(GetId(ref));
+            return refs.begin() + std::distance(keys.cbegin(), pos);
+        }
+
+        void
+        RankedReferences::assign_best(RankedReferences const& other, std::size_t count)
+        {
+            auto const first = other.keys.size() - std::min(count, other.keys.size());
+            keys.assign(other.keys.begin() + first, other.keys.end());
+            refs.assign(other.refs.begin() + first, other.refs.end());
+            rankingById.clear();
+            for (auto const& key : keys)
+            {
+                rankingById.emplace(-key.second, key.first);
+            }
+        }
+
+        void
+        RankedReferences::clear()
+        {
+            keys.clear();
+            refs.clear();
+            rankingById.clear();
+        }
+    } // namespace scrimpl
+} // namespace cppmicroservices
@@ -0,0 +1,138 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+  =============================================================================*/
+
+#ifndef RANKEDREFERENCES_HPP
+#define RANKEDREFERENCES_HPP
+
+#include "cppmicroservices/ServiceReferenceBase.h"
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace cppmicroservices
+{
+    namespace scrimpl
+    {
+
+        /**
+         * A flat set of service references ordered the same way as
+         * std::set<ServiceReferenceBase>: lowest ranked first, the best match last.
+         *
+         * The service ranking and id of a reference are read once when it is
+         * inserted and kept alongside it. Unlike a std::set, inserting, finding and
+         * erasing therefore never calls ServiceReferenceBase::operator<, which
+         * locks the properties of both references on every comparison.
+         *
+         * This class is not thread-safe.
+         */
+        class RankedReferences
+        {
+          public:
+            using const_iterator = std::vector<ServiceReferenceBase>::const_iterator;
+            using const_reverse_iterator = std::vector<ServiceReferenceBase>::const_reverse_iterator;
+
+            /**
+             * Insert a reference. Does nothing if a reference to the same service
+             * is already contained or if \c ref is invalid.
+             *
+             * \return \c true if the reference was inserted
+             */
+            bool insert(ServiceReferenceBase const& ref);
+
+            /**
+             * Remove the reference to the same service as \c ref.
+             *
+             * \return the number of removed references (0 or 1)
+             */
+            std::size_t erase(ServiceReferenceBase const& ref);
+
+            /**
+             * Returns an iterator to the reference for the same service as \c ref,
+             * or end() if there is none.
+             */
+            const_iterator find(ServiceReferenceBase const& ref) const;
+
+            /**
+             * Replace the contents of this set with the \c count best ranked
+             * references of \c other.
+             */
+            void assign_best(RankedReferences const& other, std::size_t count);
+
+            void clear();
+
+            std::size_t
+            size() const
+            {
+                return refs.size();
+            }
+
+            bool
+            empty() const
+            {
+                return refs.empty();
+            }
+
+            const_iterator
+            begin() const
+            {
+                return refs.begin();
+            }
+
+            const_iterator
+            end() const
+            {
+                return refs.end();
+            }
+
+            const_reverse_iterator
+            rbegin() const
+            {
+                return refs.rbegin();
+            }
+
+            const_reverse_iterator
+            rend() const
+            {
+                return refs.rend();
+            }
+
+          private:
+            /**
+             * Sort key of a reference, (ranking, -id). Comparing keys gives the
+             * same order as ServiceReferenceBase::operator<.
+             */
+            using RankKey = std::pair<int, long>;
+
+            static RankKey MakeKey(int ranking, long id) { return { ranking, -id }; }
+
+            std::vector<RankKey>::const_iterator FindKey(long id) const;
+
+            std::vector<RankKey> keys;                   ///< sorted keys, parallel to refs
+            std::vector<ServiceReferenceBase> refs;      ///< references, in key order
+            std::unordered_map<long, int> rankingById;   ///< ranking a contained service was inserted with
+        };
+    } // namespace scrimpl
+} // namespace cppmicroservices
+
+#endif /* RANKEDREFERENCES_HPP */
@@ -170,10 +170,8 @@ namespace cppmicroservices
             if (matchedRefsHandleSize >= metadata_.minCardinality)
             {
                 auto boundRefsHandle = boundRefs.lock(); // acquires lock on boundRefs
-                boundRefsHandle->clear();
-                std::copy_n(matchedRefsHandle->rbegin(),
-                            std::min(metadata_.maxCardinality, matchedRefsHandleSize),
-                            std::inserter(*(boundRefsHandle), boundRefsHandle->begin()));
+                boundRefsHandle->assign_best(*matchedRefsHandle,
+                                             std::min(metadata_.maxCardinality, matchedRefsHandleSize));
                 return true;
             }
             return false;
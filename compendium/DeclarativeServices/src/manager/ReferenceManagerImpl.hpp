@@ -31,6 +31,7 @@
 #    define FRIEND_TEST(x, y)
 #endif
 #include "ConcurrencyUtil.hpp"
+#include "RankedReferences.hpp"
 #include "ReferenceManager.hpp"
 #include "cppmicroservices/BundleContext.h"
 #include "cppmicroservices/ServiceTracker.h"
@@ -285,10 +286,8 @@ namespace cppmicroservices
             const std::string
                 configName_; ///< Keep track of which component configuration object this reference manager belongs to.
 
-            mutable Guarded<std::set<cppmicroservices::ServiceReferenceBase>>
-                boundRefs; ///< guarded set of bound references
-            mutable Guarded<std::set<cppmicroservices::ServiceReferenceBase>>
-                matchedRefs; ///< guarded set of matched references
+            mutable Guarded<RankedReferences> boundRefs;   ///< guarded set of bound references
+            mutable Guarded<RankedReferences> matchedRefs; ///< guarded set of matched references
 
             mutable Guarded<RefMgrListenerMap> listenersMap;                    ///< guarded map of listeners
             static std::atomic<cppmicroservices::ListenerTokenId> tokenCounter; ///< used to
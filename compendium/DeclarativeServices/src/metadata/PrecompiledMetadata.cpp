@@ -0,0 +1,230 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+  =============================================================================*/
+
+
+#include "PrecompiledMetadata.hpp"
+#include "ReferenceMetadata.hpp"
+
+#include <algorithm>
+#include <typeinfo>
+
+namespace cppmicroservices
+{
+    namespace scrimpl
+    {
+        namespace metadata
+        {
+            namespace scd = cppmicroservices::service::component::detail;
+
+            namespace
+            {
+                std::vector<std::string>
+                ToStrings(char const* const* strings, std::size_t count)
+                {
+                    return count ? std::vector<std::string>(strings, strings + count) : std::vector<std::string>();
+                }
+
+                // Copies the optional map scrComponent[key] into target. Returns false if
+                // the manifest parser would reject the value.
+                bool
+                AssignProperties(AnyMap const& scrComponent,
+                                 std::string const& key,
+                                 std::unordered_map<std::string, cppmicroservices::Any>& target)
+                {
+                    auto const value = scrComponent.find(key);
+                    if (value == scrComponent.end())
+                    {
+                        return true;
+                    }
+                    if (value->second.Type() != typeid(AnyMap))
+                    {
+                        return false;
+                    }
+                    auto const& props = ref_any_cast<AnyMap>(value->second);
+                    target.insert(props.begin(), props.end());
+                    return !props.empty();
+                }
+
+                void HashValue(scd::ManifestHash& hash, Any const& value);
+
+                void
+                HashObject(scd::ManifestHash& hash, AnyMap const& map)
+                {
+                    std::vector<AnyMap::value_type const*> members;
+                    members.reserve(map.size());
+                    for (auto const& member : map)
+                    {
+                        members.push_back(&member);
+                    }
+                    std::sort(members.begin(),
+                              members.end(),
+                              [](AnyMap::value_type const* a, AnyMap::value_type const* b)
+                              { return a->first < b->first; });
+                    hash.AddTag('o');
+                    hash.AddNumber(static_cast<long long>(members.size()));
+                    for (auto const* member : members)
+                    {
+                        hash.AddString(member->first.data(), member->first.size());
+                        HashValue(hash, member->second);
+                    }
+                }
+
+                // Feeds value to hash in the canonical form described at scd::ManifestHash.
+                void
+                HashValue(scd::ManifestHash& hash, Any const& value)
+                {
+                    if (value.Type() == typeid(AnyMap))
+                    {
+                        HashObject(hash, ref_any_cast<AnyMap>(value));
+                    }
+                    else if (value.Type() == typeid(std::vector<Any>))
+                    {
+                        auto const& elements = ref_any_cast<std::vector<Any>>(value);
+                        hash.AddTag('a');
+                        hash.AddNumber(static_cast<long long>(elements.size()));
+                        for (auto const& element : elements)
+                        {
+                            HashValue(hash, element);
+                        }
+                    }
+                    else if (value.Type() == typeid(std::string))
+                    {
+                        auto const& str = ref_any_cast<std::string>(value);
+                        hash.AddString(str.data(), str.size());
+                    }
+                    else if (value.Type() == typeid(bool))
+                    {
+                        hash.AddTag(ref_any_cast<bool>(value) ? 't' : 'f');
+                    }
+                    else if (value.Type() == typeid(int))
+                    {
+                        hash.AddTag('i');
+                        hash.AddNumber(ref_any_cast<int>(value));
+                    }
+                    else
+                    {
+                        hash.AddTag('?');
+                    }
+                }
+
+                std::shared_ptr<ComponentMetadata>
+                CreateComponentMetadata(scd::ComponentMetadataEntry const& entry, Any const& scrComponent)
+                {
+                    if (scrComponent.Type() != typeid(AnyMap))
+                    {
+                        return nullptr;
+                    }
+                    auto const& componentMap = ref_any_cast<AnyMap>(scrComponent);
+                    auto const implClass = componentMap.find("implementation-class");
+                    if (implClass == componentMap.end() || implClass->second.Type() != typeid(std::string)
+                        || ref_any_cast<std::string>(implClass->second) != entry.implClassName)
+                    {
+                        return nullptr;
+                    }
+
+                    auto compMetadata = std::make_shared<ComponentMetadata>();
+                    compMetadata->name = entry.name;
+                    compMetadata->instanceName = compMetadata->name;
+                    compMetadata->implClassName = entry.implClassName;
+                    compMetadata->enabled = entry.enabled;
+                    compMetadata->immediate = entry.immediate;
+                    compMetadata->configurationPolicy = entry.configurationPolicy;
+                    compMetadata->configurationPids = ToStrings(entry.configurationPids, entry.configurationPidCount);
+                    compMetadata->factoryComponentID = entry.factoryComponentID;
+                    compMetadata->serviceMetadata.scope = entry.serviceScope;
+                    compMetadata->serviceMetadata.interfaces
+                        = ToStrings(entry.serviceInterfaces, entry.serviceInterfaceCount);
+
+                    compMetadata->refsMetadata.reserve(entry.referenceCount);
+                    for (std::size_t i = 0; i < entry.referenceCount; ++i)
+                    {
+                        auto const& ref = entry.references[i];
+                        ReferenceMetadata refMetadata {};
+                        refMetadata.name = ref.name;
+                        refMetadata.interfaceName = ref.interfaceName;
+                        refMetadata.cardinality = ref.cardinality;
+                        std::tie(refMetadata.minCardinality, refMetadata.maxCardinality)
+                            = GetReferenceCardinalityExtents(refMetadata.cardinality);
+                        refMetadata.policy = ref.policy;
+                        refMetadata.policyOption = ref.policyOption;
+                        refMetadata.target = ref.target;
+                        compMetadata->refsMetadata.push_back(std::move(refMetadata));
+                    }
+
+                    if (!AssignProperties(componentMap, "properties", compMetadata->properties)
+                        || !AssignProperties(componentMap,
+                                             "factory-properties",
+                                             compMetadata->factoryComponentProperties))
+                    {
+                        return nullptr;
+                    }
+                    return compMetadata;
+                }
+            } // namespace
+
+            std::vector<std::shared_ptr<ComponentMetadata>>
+            CreateComponentsMetadata(scd::ComponentMetadataTable const& table, AnyMap const& scrMetadata)
+            {
+                if (table.version != scd::COMPONENT_METADATA_TABLE_VERSION
+                    || table.manifestHash != HashScrMetadata(scrMetadata))
+                {
+                    return {};
+                }
+                auto const version = scrMetadata.find("version");
+                auto const components = scrMetadata.find("components");
+                if (version == scrMetadata.end() || version->second.Type() != typeid(int)
+                    || ref_any_cast<int>(version->second) != 1 || components == scrMetadata.end()
+                    || components->second.Type() != typeid(std::vector<Any>))
+                {
+                    return {};
+                }
+                auto const& scrComponents = ref_any_cast<std::vector<Any>>(components->second);
+                if (scrComponents.size() != table.componentCount)
+                {
+                    return {};
+                }
+
+                std::vector<std::shared_ptr<ComponentMetadata>> componentsMetadata;
+                componentsMetadata.reserve(table.componentCount);
+                for (std::size_t i = 0; i < table.componentCount; ++i)
+                {
+                    auto compMetadata = CreateComponentMetadata(table.components[i], scrComponents[i]);
+                    if (!compMetadata)
+                    {
+                        return {};
+                    }
+                    componentsMetadata.push_back(std::move(compMetadata));
+                }
+                return componentsMetadata;
+            }
+
+            std::uint64_t
+            HashScrMetadata(AnyMap const& scrMetadata)
+            {
+                scd::ManifestHash hash;
+                HashObject(hash, scrMetadata);
+                return hash.Value();
+            }
+
+        } // namespace metadata
+    }     // namespace scrimpl
+} // namespace cppmicroservices
@@ -0,0 +1,72 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+  =============================================================================*/
+
+
+#ifndef PRECOMPILEDMETADATA_HPP
+#define PRECOMPILEDMETADATA_HPP
+
+#include "ComponentMetadata.hpp"
+#include "cppmicroservices/AnyMap.h"
+#include "cppmicroservices/servicecomponent/detail/ComponentMetadataTable.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cppmicroservices
+{
+    namespace scrimpl
+    {
+        namespace metadata
+        {
+
+            /*
+             * @brief Creates the component metadatas from a table generated by SCRCodeGen
+             *
+             * The strings in the table already hold the values the manifest parser
+             * would derive, so no validation is repeated. Only the component properties
+             * and factory properties are taken from the manifest.
+             *
+             * @param table the precompiled metadata of the bundle
+             * @param scrMetadata the "scr" manifest of the same bundle
+             * @returns the component metadatas, or an empty vector if the table does not
+             *          describe @c scrMetadata (e.g. because it was built from a
+             *          different manifest). The manifest must be parsed in that case.
+             */
+            std::vector<std::shared_ptr<ComponentMetadata>> CreateComponentsMetadata(
+                cppmicroservices::service::component::detail::ComponentMetadataTable const& table,
+                cppmicroservices::AnyMap const& scrMetadata);
+
+            /*
+             * @brief Computes the ManifestHash of the "scr" manifest of a bundle
+             *
+             * @param scrMetadata the "scr" manifest of a bundle
+             * @returns the hash SCRCodeGen stores in the table it generates for
+             *          the same manifest
+             */
+            std::uint64_t HashScrMetadata(cppmicroservices::AnyMap const& scrMetadata);
+
+        } // namespace metadata
+    }     // namespace scrimpl
+} // namespace cppmicroservices
+
+#endif // PRECOMPILEDMETADATA_HPP
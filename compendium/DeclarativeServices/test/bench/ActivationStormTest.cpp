@@ -0,0 +1,105 @@
+#include <cppmicroservices/BundleContext.h>
+#include <cppmicroservices/Framework.h>
+#include <cppmicroservices/FrameworkEvent.h>
+#include <cppmicroservices/FrameworkFactory.h>
+#include <cppmicroservices/ServiceObjects.h>
+#include <cppmicroservices/ServiceReference.h>
+
+#include "../TestUtils.hpp"
+#include <TestInterfaces/Interfaces.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// The activation storm runs for a long time, up to 64 threads and 10^5
+// component instances. Define PERFORM_DS_SCALING_BENCHMARKS to build it.
+#ifdef PERFORM_DS_SCALING_BENCHMARKS
+namespace
+{
+    /*
+     * A framework running Declarative Services and TestBundleDSTOI15, whose
+     * prototype scope component is activated for every service object
+     * requested and deactivated when the service object is released. A
+     * population of active component instances is kept alive, shared by all
+     * threads of a benchmark run.
+     */
+    struct ActivePrototypes
+    {
+        explicit ActivePrototypes(int64_t count) : framework(cppmicroservices::FrameworkFactory().NewFramework())
+        {
+            framework.Start();
+            context = framework.GetBundleContext();
+            test::InstallAndStartDS(context);
+            test::InstallAndStartBundle(context, "TestBundleDSTOI15");
+
+            auto objects = context.GetServiceObjects(context.GetServiceReference<test::Interface1>());
+            instances.reserve(static_cast<std::size_t>(count));
+            for (int64_t i = 0; i < count; ++i)
+            {
+                instances.push_back(objects.GetService());
+            }
+        }
+
+        ~ActivePrototypes()
+        {
+            instances.clear();
+            framework.Stop();
+            framework.WaitForStop(std::chrono::milliseconds::zero());
+        }
+
+        cppmicroservices::Framework framework;
+        cppmicroservices::BundleContext context;
+        std::vector<std::shared_ptr<test::Interface1>> instances;
+    };
+
+    /*
+     * Returns the population of the current benchmark run, which is kept for
+     * the runs with other thread counts.
+     */
+    std::shared_ptr<ActivePrototypes>
+    GetActivePrototypes(int64_t count)
+    {
+        static std::mutex mutex;
+        static std::shared_ptr<ActivePrototypes> population;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!population || static_cast<int64_t>(population->instances.size()) != count)
+        {
+            population.reset();
+            population = std::make_shared<ActivePrototypes>(count);
+        }
+        return population;
+    }
+} // namespace
+
+/**
+ * Activate and deactivate component instances from an increasing number of
+ * threads, while a population of instances of the same component is
+ * active.
+ */
+static void
+PrototypeComponentActivationStorm(benchmark::State& state)
+{
+    auto population = GetActivePrototypes(state.range(0));
+    auto objects = population->context.GetServiceObjects(population->context.GetServiceReference<test::Interface1>());
+
+    for (auto _ : state)
+    {
+        auto service = objects.GetService();
+        benchmark::DoNotOptimize(service);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["instances"]
+        = benchmark::Counter(static_cast<double>(state.range(0)), benchmark::Counter::kAvgThreads);
+}
+
+BENCHMARK(PrototypeComponentActivationStorm)
+    ->RangeMultiplier(10)
+    ->Range(100, 100000)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+#endif
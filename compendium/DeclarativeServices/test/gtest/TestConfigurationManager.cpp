@@ -0,0 +1,145 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+  =============================================================================*/
+
+
+#include "gtest/gtest.h"
+
+#include "../../src/manager/ConfigurationManager.hpp"
+#include "Mocks.hpp"
+#include "cppmicroservices/Framework.h"
+#include "cppmicroservices/FrameworkEvent.h"
+#include "cppmicroservices/FrameworkFactory.h"
+
+using cppmicroservices::service::cm::ConfigurationEventType;
+
+namespace cppmicroservices
+{
+    namespace scrimpl
+    {
+
+        class ConfigurationManagerTest : public ::testing::Test
+        {
+          protected:
+            ConfigurationManagerTest() : framework(cppmicroservices::FrameworkFactory().NewFramework()) {}
+
+            void
+            SetUp() override
+            {
+                framework.Start();
+                auto metadata = std::make_shared<metadata::ComponentMetadata>();
+                metadata->properties["fromMetadata"] = std::string("metadata");
+                metadata->properties["shared"] = std::string("metadata");
+                metadata->configurationPids = { "pidA", "pidB" };
+                manager = std::make_shared<ConfigurationManager>(metadata,
+                                                                 framework.GetBundleContext(),
+                                                                 std::make_shared<MockLogger>());
+            }
+
+            void
+            TearDown() override
+            {
+                manager.reset();
+                framework.Stop();
+                framework.WaitForStop(std::chrono::milliseconds::zero());
+            }
+
+            void
+            Update(std::string const& pid, cppmicroservices::AnyMap props)
+            {
+                bool wasSatisfied = false;
+                bool isSatisfied = false;
+                bool changeCountDifferent = false;
+                manager->UpdateMergedProperties(pid,
+                                                std::make_shared<cppmicroservices::AnyMap>(std::move(props)),
+                                                ConfigurationEventType::CM_UPDATED,
+                                                ++changeCount,
+                                                wasSatisfied,
+                                                isSatisfied,
+                                                changeCountDifferent);
+            }
+
+            void
+            Delete(std::string const& pid)
+            {
+                bool wasSatisfied = false;
+                bool isSatisfied = false;
+                bool changeCountDifferent = false;
+                manager->UpdateMergedProperties(pid,
+                                                nullptr,
+                                                ConfigurationEventType::CM_DELETED,
+                                                ++changeCount,
+                                                wasSatisfied,
+                                                isSatisfied,
+                                                changeCountDifferent);
+            }
+
+            cppmicroservices::Framework framework;
+            std::shared_ptr<ConfigurationManager> manager;
+            unsigned long changeCount = 0;
+        };
+
+        TEST_F(ConfigurationManagerTest, SnapshotIsSharedUntilUpdate)
+        {
+            auto const initial = manager->GetPropertiesSnapshot();
+            ASSERT_EQ(initial, manager->GetPropertiesSnapshot());
+            ASSERT_EQ(2u, initial->size());
+
+            cppmicroservices::AnyMap props(cppmicroservices::AnyMap::UNORDERED_MAP_CASEINSENSITIVE_KEYS);
+            props["shared"] = std::string("pidA");
+            Update("pidA", props);
+
+            auto const updated = manager->GetPropertiesSnapshot();
+            ASSERT_NE(initial, updated);
+            ASSERT_EQ(updated, manager->GetPropertiesSnapshot());
+            // Snapshots taken earlier are not modified by an update.
+            ASSERT_EQ("metadata", initial->at("shared").ToStringNoExcept());
+            ASSERT_EQ("pidA", updated->at("shared").ToStringNoExcept());
+            ASSERT_EQ("pidA", manager->GetProperties().at("shared").ToStringNoExcept());
+        }
+
+        TEST_F(ConfigurationManagerTest, MergedPropertiesFollowPidPrecedence)
+        {
+            cppmicroservices::AnyMap propsA(cppmicroservices::AnyMap::UNORDERED_MAP_CASEINSENSITIVE_KEYS);
+            propsA["shared"] = std::string("pidA");
+            propsA["fromA"] = std::string("pidA");
+            cppmicroservices::AnyMap propsB(cppmicroservices::AnyMap::UNORDERED_MAP_CASEINSENSITIVE_KEYS);
+            propsB["shared"] = std::string("pidB");
+
+            // pidB is listed last and takes precedence, regardless of the update order.
+            Update("pidB", propsB);
+            Update("pidA", propsA);
+            auto merged = manager->GetPropertiesSnapshot();
+            ASSERT_EQ("pidB", merged->at("shared").ToStringNoExcept());
+            ASSERT_EQ("pidA", merged->at("fromA").ToStringNoExcept());
+            ASSERT_EQ("metadata", merged->at("fromMetadata").ToStringNoExcept());
+
+            Delete("pidB");
+            merged = manager->GetPropertiesSnapshot();
+            ASSERT_EQ("pidA", merged->at("shared").ToStringNoExcept());
+
+            Delete("pidA");
+            merged = manager->GetPropertiesSnapshot();
+            ASSERT_EQ(2u, merged->size());
+            ASSERT_EQ("metadata", merged->at("shared").ToStringNoExcept());
+        }
+    } // namespace scrimpl
+} // namespace cppmicroservices
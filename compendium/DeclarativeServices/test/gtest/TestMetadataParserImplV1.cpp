@@ -21,6 +21,7 @@
   =============================================================================*/
 #include "../../src/metadata/MetadataParserFactory.hpp"
 #include "../../src/metadata/MetadataParserImpl.hpp"
+#include "../../src/metadata/PrecompiledMetadata.hpp"
 #include "../../src/metadata/ReferenceMetadata.hpp"
 #include "../../src/metadata/Util.hpp"
 #include "Mocks.hpp"
@@ -37,6 +38,8 @@ using cppmicroservices::AnyMap;
 using cppmicroservices::scrimpl::FakeLogger;
 using cppmicroservices::scrimpl::MockLogger;
 using cppmicroservices::scrimpl::metadata::ComponentMetadata;
+using cppmicroservices::scrimpl::metadata::CreateComponentsMetadata;
+using cppmicroservices::scrimpl::metadata::HashScrMetadata;
 using cppmicroservices::scrimpl::metadata::MetadataParserFactory;
 using cppmicroservices::scrimpl::metadata::MetadataParserImplV1;
 using cppmicroservices::scrimpl::util::ObjectValidator;
@@ -168,6 +171,101 @@ namespace
         ASSERT_EQ(component->implClassName, "Foo::Impl2");
     }
 
+    // The metadata created from a table generated by SCRCodeGen must be the same
+    // as the metadata parsed from the manifest the table was generated from.
+    TEST_F(MetadataParserImplV1Test, CreateFromPrecompiledTable)
+    {
+        namespace scd = cppmicroservices::service::component::detail;
+        char const* const interfaces[] = { "SpellCheck::ISpellCheckService" };
+        scd::ReferenceMetadataEntry const references[] = {
+            { "dictionary", "DictionaryService::IDictionaryService", "1..1", "static", "reluctant", "" }
+        };
+        scd::ComponentMetadataEntry const components[] = {
+            { "DSSpellCheck::SpellCheckImpl",
+             "DSSpellCheck::SpellCheckImpl",
+             true, false,
+             "ignore",
+             nullptr, 0,
+             "",
+             "singleton",
+             interfaces, 1,
+             references, 1 }
+        };
+        auto const manifest = ManifestHelper::GetTestManifest("manifest_json");
+        scd::ComponentMetadataTable const table
+            = { scd::COMPONENT_METADATA_TABLE_VERSION, HashScrMetadata(manifest), components, 1 };
+        auto const parsed = MetadataParserFactory::Create(1, GetLogger())->ParseAndGetComponentsMetadata(manifest);
+        auto const precompiled = CreateComponentsMetadata(table, manifest);
+        ASSERT_THAT(precompiled, ::testing::SizeIs(1));
+        ASSERT_THAT(parsed, ::testing::SizeIs(1));
+
+        auto const& expected = *parsed[0];
+        auto const& actual = *precompiled[0];
+        EXPECT_EQ(actual.name, expected.name);
+        EXPECT_EQ(actual.instanceName, expected.instanceName);
+        EXPECT_EQ(actual.implClassName, expected.implClassName);
+        EXPECT_EQ(actual.enabled, expected.enabled);
+        EXPECT_EQ(actual.immediate, expected.immediate);
+        EXPECT_EQ(actual.activateMethodName, expected.activateMethodName);
+        EXPECT_EQ(actual.configurationPolicy, expected.configurationPolicy);
+        EXPECT_EQ(actual.configurationPids, expected.configurationPids);
+        EXPECT_EQ(actual.factoryComponentID, expected.factoryComponentID);
+        EXPECT_EQ(actual.serviceMetadata.scope, expected.serviceMetadata.scope);
+        EXPECT_EQ(actual.serviceMetadata.interfaces, expected.serviceMetadata.interfaces);
+        EXPECT_EQ(actual.properties.size(), expected.properties.size());
+        ASSERT_THAT(actual.refsMetadata, ::testing::SizeIs(1));
+        auto const& expectedRef = expected.refsMetadata[0];
+        auto const& actualRef = actual.refsMetadata[0];
+        EXPECT_EQ(actualRef.name, expectedRef.name);
+        EXPECT_EQ(actualRef.interfaceName, expectedRef.interfaceName);
+        EXPECT_EQ(actualRef.cardinality, expectedRef.cardinality);
+        EXPECT_EQ(actualRef.minCardinality, expectedRef.minCardinality);
+        EXPECT_EQ(actualRef.maxCardinality, expectedRef.maxCardinality);
+        EXPECT_EQ(actualRef.policy, expectedRef.policy);
+        EXPECT_EQ(actualRef.policyOption, expectedRef.policyOption);
+        EXPECT_EQ(actualRef.scope, expectedRef.scope);
+        EXPECT_EQ(actualRef.target, expectedRef.target);
+
+        // a table generated from a different manifest is not used
+        scd::ComponentMetadataEntry otherComponents[] = { components[0] };
+        otherComponents[0].implClassName = "DSSpellCheck::OtherImpl";
+        scd::ComponentMetadataTable const otherTable
+            = { scd::COMPONENT_METADATA_TABLE_VERSION, table.manifestHash, otherComponents, 1 };
+        EXPECT_TRUE(CreateComponentsMetadata(otherTable, manifest).empty());
+        scd::ComponentMetadataTable const otherHashTable
+            = { scd::COMPONENT_METADATA_TABLE_VERSION, table.manifestHash + 1, components, 1 };
+        EXPECT_TRUE(CreateComponentsMetadata(otherHashTable, manifest).empty());
+        scd::ComponentMetadataTable const newerTable
+            = { scd::COMPONENT_METADATA_TABLE_VERSION + 1, table.manifestHash, components, 1 };
+        EXPECT_TRUE(CreateComponentsMetadata(newerTable, manifest).empty());
+
+        // an empty properties map is rejected like the manifest parser does, so
+        // the table is not used
+        scd::ComponentMetadataEntry const emptyPropsComponents[] = {
+            { "Foo::Impl1",
+             "Foo::Impl1",
+             true, false,
+             "ignore",
+             nullptr, 0,
+             "",
+             "singleton",
+             nullptr, 0,
+             nullptr, 0 }
+        };
+        auto const emptyPropsManifest = ManifestHelper::GetTestManifest("manifest_empty_props");
+        scd::ComponentMetadataTable const emptyPropsTable
+            = { scd::COMPONENT_METADATA_TABLE_VERSION, HashScrMetadata(emptyPropsManifest), emptyPropsComponents, 1 };
+        EXPECT_TRUE(CreateComponentsMetadata(emptyPropsTable, emptyPropsManifest).empty());
+    }
+
+    // SCRCodeGen hashes the manifest it reads with jsoncpp, the runtime hashes the
+    // parsed AnyMap. See ComponentMetadataTableTest.TestManifestHash in the SCRCodeGen
+    // tests, which expects the same value for this manifest.
+    TEST_F(MetadataParserImplV1Test, HashScrMetadata)
+    {
+        EXPECT_EQ(HashScrMetadata(ManifestHelper::GetTestManifest("manifest_json")), 0x480ac4412dbe6739ULL);
+    }
+
     // For the SCR map specified in "scr", we expect the exception message
     // output by the Metadata Parser to be exactly errorOutput.
     // Instead, if we expect the errorOutput to be contained in the generated error message,
@@ -340,6 +438,9 @@ namespace
             MetadataInvalidManifestState("manifest_illegal_ref_interface",
                                          "Unexpected type for the name 'interface'. Exception: "
                                          "cppmicroservices::BadAnyCastException: "),
+            MetadataInvalidManifestState("manifest_empty_props", "Value for the name 'properties' cannot be empty."),
+            MetadataInvalidManifestState("manifest_empty_factory_props",
+                                         "Value for the name 'factory-properties' cannot be empty."),
             MetadataInvalidManifestState("manifest_illegal_scope",
                                          "Invalid value 'global'. The valid choices are : [bundle, prototype, "
                                          "singleton]. Could not load the component with index: 0"),
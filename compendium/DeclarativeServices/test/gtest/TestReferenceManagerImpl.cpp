@@ -722,5 +722,53 @@ namespace cppmicroservices
             reg.Unregister();
         }
 
+        // RankedReferences caches the ranking and id of each reference and must keep
+        // the same order as std::set<ServiceReferenceBase>.
+        TEST(RankedReferencesTest, OrderMatchesServiceReferenceOrder)
+        {
+            auto framework = cppmicroservices::FrameworkFactory().NewFramework();
+            framework.Start();
+            auto bc = framework.GetBundleContext();
+
+            std::vector<ServiceRegistration<dummy::Reference1>> regs;
+            for (int ranking : { 0, 5, -3, 5, 0, 10 })
+            {
+                regs.push_back(bc.RegisterService<dummy::Reference1>(std::make_shared<dummy::Reference1>(),
+                                                                     {
+                                                                         {Constants::SERVICE_RANKING, Any(ranking)}
+                }));
+            }
+
+            RankedReferences ranked;
+            std::set<ServiceReferenceBase> expected;
+            for (auto const& reg : regs)
+            {
+                EXPECT_TRUE(ranked.insert(reg.GetReference()));
+                expected.insert(reg.GetReference());
+            }
+            EXPECT_FALSE(ranked.insert(regs.front().GetReference()));
+            EXPECT_FALSE(ranked.insert(ServiceReferenceU()));
+            ASSERT_EQ(ranked.size(), expected.size());
+            EXPECT_TRUE(std::equal(ranked.begin(), ranked.end(), expected.begin()));
+
+            EXPECT_NE(ranked.find(regs[2].GetReference()), ranked.end());
+            EXPECT_EQ(ranked.erase(regs[2].GetReference()), 1u);
+            EXPECT_EQ(ranked.erase(regs[2].GetReference()), 0u);
+            EXPECT_EQ(ranked.find(regs[2].GetReference()), ranked.end());
+            expected.erase(regs[2].GetReference());
+            EXPECT_TRUE(std::equal(ranked.begin(), ranked.end(), expected.begin()));
+
+            RankedReferences best;
+            best.assign_best(ranked, 2);
+            ASSERT_EQ(best.size(), 2u);
+            EXPECT_EQ(*best.rbegin(), regs[5].GetReference());
+            EXPECT_EQ(*best.begin(), regs[1].GetReference());
+            EXPECT_NE(best.find(regs[1].GetReference()), best.end());
+            EXPECT_EQ(best.find(regs[3].GetReference()), best.end());
+
+            framework.Stop();
+            framework.WaitForStop(std::chrono::milliseconds::zero());
+        }
+
     } // namespace scrimpl
 } // namespace cppmicroservices
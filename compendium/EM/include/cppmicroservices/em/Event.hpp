@@ -28,6 +28,9 @@
 #include "cppmicroservices/AnyMap.h"
 #include "cppmicroservices/LDAPFilter.h"
 
+#include <memory>
+#include <string_view>
+
 namespace cppmicroservices::service::em
 {
 
@@ -51,6 +54,10 @@ namespace cppmicroservices::service::em
      * event properties being changed by arbitrary pieces of code, ensuring the originality of the
      * published event.
      *
+     * The topic and properties of an Event are held in an immutable, reference-counted block
+     * which is shared between copies. Copying an Event, e.g. to deliver it to many handlers,
+     * does not copy its properties.
+     *
      * Interactions with events occurs through the EMEvent object directly. See
      * \c cppmicroservices::em::Constants for information regarding what properties an event can have.
      */
@@ -77,11 +84,11 @@ namespace cppmicroservices::service::em
          *
          * @param topic The topic of the event.
          * @param properties The event's properties. This is immutable and a copy of the original
-         * properties
+         * properties. Pass an rvalue to avoid copying the properties.
          *
          * @throws std::logic_error If the topic format is invalid
          */
-        Event(std::string const& topic, EventProperties const properties = EventProperties());
+        Event(std::string const& topic, EventProperties properties = EventProperties());
 
         /**
          * @brief Compares whether or not two Events are equal to each other
@@ -118,17 +125,21 @@ namespace cppmicroservices::service::em
          * @brief Returns the property associated with the specified property name. If the specified
          * property does not exist, an empty <code>cppmicroservices::Any</code> is returned
          *
+         * The returned reference remains valid for as long as this Event, or any copy of it, exists.
+         *
          * @param propName The name of the property to get
          * @return Any The value of the property if found, an empty Any if not found
          */
-        [[nodiscard]] Any const GetProperty(std::string const& propName) const;
+        [[nodiscard]] Any const& GetProperty(std::string const& propName) const;
 
         /**
          * @brief Returns the properties map containing the properties of the event.
          *
+         * The returned reference remains valid for as long as this Event, or any copy of it, exists.
+         *
          * @return The properties
          */
-        [[nodiscard]] AnyMap const GetProperties() const;
+        [[nodiscard]] AnyMap const& GetProperties() const;
 
         /**
          * @brief Returns a vector of all the specified property names.
@@ -142,7 +153,18 @@ namespace cppmicroservices::service::em
          *
          * @return std::string The topic
          */
-        [[nodiscard]] std::string GetTopic() const;
+        [[nodiscard]] std::string const& GetTopic() const;
+
+        /**
+         * @brief Returns the '/' separated tokens of the topic.
+         *
+         * The tokens are computed once when the Event is constructed and refer to the topic
+         * string held by this Event. For the topic "my/event/topic" the tokens are "my", "event"
+         * and "topic".
+         *
+         * @return std::vector<std::string_view> The topic tokens
+         */
+        [[nodiscard]] std::vector<std::string_view> const& GetTopicTokens() const;
 
         /**
          * @brief Returns whether or not the Event matches against the provided \c LDAPFilter .
@@ -153,8 +175,9 @@ namespace cppmicroservices::service::em
         [[nodiscard]] bool Matches(LDAPFilter const& filter) const;
 
       private:
-        std::string const topic;
-        AnyMap const properties;
+        struct EventData;
+
+        std::shared_ptr<EventData const> d;
     };
 } // namespace cppmicroservices::service::em
 
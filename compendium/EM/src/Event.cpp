@@ -28,14 +28,38 @@
 namespace cppmicroservices::service::em
 {
 
+    struct Event::EventData
+    {
+        EventData(std::string const& t, EventProperties&& props) : topic(t), properties(std::move(props)) {}
+
+        std::string const topic;
+        AnyMap const properties;
+        std::vector<std::string_view> topicTokens;
+    };
+
     namespace
     {
         bool
         ValidateTopic(std::string const& topic)
         {
-            std::string regexExpr = "([A-Za-z0-9_.]+)(\\/[A-Za-z0-9_.]+)*";
+            static std::regex const topicRegex("([A-Za-z0-9_.]+)(\\/[A-Za-z0-9_.]+)*");
 
-            return std::regex_match(topic, std::regex(regexExpr));
+            return std::regex_match(topic, topicRegex);
+        }
+
+        std::vector<std::string_view>
+        TokenizeTopic(std::string_view topic)
+        {
+            std::vector<std::string_view> tokens;
+            std::string_view::size_type start = 0;
+            std::string_view::size_type pos = 0;
+            while ((pos = topic.find('/', start)) != std::string_view::npos)
+            {
+                tokens.push_back(topic.substr(start, pos - start));
+                start = pos + 1;
+            }
+            tokens.push_back(topic.substr(start));
+            return tokens;
         }
 
         bool
@@ -45,18 +69,27 @@ namespace cppmicroservices::service::em
         }
     } // namespace
 
-    Event::Event(std::string const& topic, EventProperties const properties) : topic(topic), properties(properties)
+    Event::Event(std::string const& topic, EventProperties properties)
     {
         if (!ValidateTopic(topic))
         {
             throw std::logic_error("The topic does not match the expected format.");
         }
+
+        auto data = std::make_shared<EventData>(topic, std::move(properties));
+        // tokens refer to the topic string owned by the (never moved) shared block
+        data->topicTokens = TokenizeTopic(data->topic);
+        d = std::move(data);
     }
 
     bool
     Event::operator==(Event const& other) const
     {
-        return (topic == other.topic) && PropsAreEqual(properties, other.properties);
+        if (d == other.d)
+        {
+            return true;
+        }
+        return (d->topic == other.d->topic) && PropsAreEqual(d->properties, other.d->properties);
     }
 
     bool
@@ -68,34 +101,36 @@ namespace cppmicroservices::service::em
     [[nodiscard]] bool
     Event::ContainsProperty(std::string const& propName) const
     {
-        return properties.find(propName) != properties.end();
+        return d->properties.find(propName) != d->properties.end();
     }
 
-    [[nodiscard]] Any const
+    [[nodiscard]] Any const&
     Event::GetProperty(std::string const& propName) const
     {
-        auto itr = properties.find(propName);
-        if (itr == properties.end())
+        static Any const emptyAny;
+
+        auto itr = d->properties.find(propName);
+        if (itr == d->properties.end())
         {
-            return Any();
+            return emptyAny;
         }
 
         return itr->second;
     }
 
-    [[nodiscard]] AnyMap const
+    [[nodiscard]] AnyMap const&
     Event::GetProperties() const
     {
-        return properties;
+        return d->properties;
     }
 
     [[nodiscard]] std::vector<std::string>
     Event::GetPropertyNames() const
     {
-        std::vector<std::string> props(properties.size());
+        std::vector<std::string> props(d->properties.size());
 
         size_t index = 0;
-        for (auto const& [key, value] : properties)
+        for (auto const& [key, value] : d->properties)
         {
             US_UNUSED(value);
             props[index++] = key;
@@ -104,16 +139,22 @@ namespace cppmicroservices::service::em
         return props;
     }
 
-    [[nodiscard]] std::string
+    [[nodiscard]] std::string const&
     Event::GetTopic() const
     {
-        return topic;
+        return d->topic;
+    }
+
+    [[nodiscard]] std::vector<std::string_view> const&
+    Event::GetTopicTokens() const
+    {
+        return d->topicTokens;
     }
 
     [[nodiscard]] bool
     Event::Matches(LDAPFilter const& filter) const
     {
-        return filter.Match(properties);
+        return filter.Match(d->properties);
     }
 
 } // namespace cppmicroservices::service::em
\ No newline at end of file
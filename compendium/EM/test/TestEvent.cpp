@@ -84,6 +84,20 @@ namespace
         });
     }
 
+    TEST(EventTest, TestCopySharesProperties)
+    {
+        EventProperties props({
+            {"tProp1", std::string("hi")}
+        });
+        Event evt1("some/valid/topic", std::move(props));
+        Event evt2(evt1);
+
+        // copies refer to the same immutable property storage
+        ASSERT_EQ(&evt1.GetProperties(), &evt2.GetProperties());
+        ASSERT_EQ(&evt1.GetProperty("tProp1"), &evt2.GetProperty("tProp1"));
+        ASSERT_EQ(cppmicroservices::any_cast<std::string>(evt2.GetProperty("tProp1")), "hi");
+    }
+
     TEST(EventTest, TestEquality)
     {
         // Same topic, no props
@@ -182,6 +196,20 @@ namespace
         ASSERT_EQ(evt.GetTopic(), "my/event/topic");
     }
 
+    TEST(EventTest, TestGetTopicTokens)
+    {
+        Event evt("my/event/topic");
+        auto const& tokens = evt.GetTopicTokens();
+        ASSERT_EQ(tokens.size(), 3ul);
+        ASSERT_EQ(tokens[0], "my");
+        ASSERT_EQ(tokens[1], "event");
+        ASSERT_EQ(tokens[2], "topic");
+
+        Event single("topic");
+        ASSERT_EQ(single.GetTopicTokens().size(), 1ul);
+        ASSERT_EQ(single.GetTopicTokens()[0], "topic");
+    }
+
     TEST(EventTest, TestFilterMatches)
     {
         EventProperties props_1({
@@ -0,0 +1,172 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+  =============================================================================*/
+
+
+#ifndef ComponentMetadataTable_hpp
+#define ComponentMetadataTable_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Prefix of the function a bundle exports to hand its precompiled component
+ * metadata table to the declarative services runtime. The bundle symbolic name
+ * is appended to the prefix, see US_SET_CTX_PREFIX.
+ */
+#define US_SCR_METADATA_TABLE_PREFIX _us_scr_component_metadata_table_
+
+namespace cppmicroservices
+{
+    namespace service
+    {
+        namespace component
+        {
+            namespace detail
+            {
+
+                /**
+                 * Version of the layout of the structures below. The runtime ignores
+                 * tables of any other version and parses the bundle manifest instead.
+                 */
+                constexpr unsigned int COMPONENT_METADATA_TABLE_VERSION = 2;
+
+                /**
+                 * Precompiled metadata of a component reference. All strings hold
+                 * the values the runtime would derive from the manifest, including
+                 * defaults for names missing from the manifest. \c target is empty
+                 * if the reference has no target filter.
+                 */
+                struct ReferenceMetadataEntry
+                {
+                    char const* name;
+                    char const* interfaceName;
+                    char const* cardinality;
+                    char const* policy;
+                    char const* policyOption;
+                    char const* target;
+                };
+
+                /**
+                 * Precompiled metadata of a component. The component properties and
+                 * factory properties are not part of the table; the runtime takes
+                 * them from the bundle manifest.
+                 */
+                struct ComponentMetadataEntry
+                {
+                    char const* name;
+                    char const* implClassName;
+                    bool enabled;
+                    bool immediate;
+                    char const* configurationPolicy;
+                    char const* const* configurationPids;
+                    std::size_t configurationPidCount;
+                    char const* factoryComponentID;
+                    char const* serviceScope;
+                    char const* const* serviceInterfaces;
+                    std::size_t serviceInterfaceCount;
+                    ReferenceMetadataEntry const* references;
+                    std::size_t referenceCount;
+                };
+
+                /**
+                 * The precompiled metadata of all components of a bundle, in the
+                 * order they appear in the bundle manifest. SCRCodeGen generates this
+                 * table together with the component instance factory functions.
+                 * \c manifestHash is the ManifestHash of the "scr" manifest section
+                 * the table was generated from; the runtime ignores the table if the
+                 * installed manifest has a different hash.
+                 */
+                struct ComponentMetadataTable
+                {
+                    unsigned int version;
+                    std::uint64_t manifestHash;
+                    ComponentMetadataEntry const* components;
+                    std::size_t componentCount;
+                };
+
+                /**
+                 * 64-bit FNV-1a hash of the "scr" section of a bundle manifest.
+                 *
+                 * SCRCodeGen and the runtime parse the manifest with different JSON
+                 * libraries, so both feed the section in the same canonical form:
+                 * an object as 'o', its member count and its members sorted by name,
+                 * each as the name followed by the value; an array as 'a', its size
+                 * and its elements; a string as AddString does; a boolean as 't' or
+                 * 'f' and an integer as 'i' followed by AddNumber. Null values are
+                 * left out of objects and arrays, as the runtime drops them, and any
+                 * other value is fed as '?'. String values are fed as the runtime
+                 * sees them, i.e. without a leading '%'.
+                 */
+                class ManifestHash
+                {
+                  public:
+                    void
+                    AddTag(char tag)
+                    {
+                        Add(&tag, 1);
+                    }
+
+                    void
+                    AddNumber(long long number)
+                    {
+                        auto const digits = std::to_string(number);
+                        Add(digits.data(), digits.size());
+                        AddTag(';');
+                    }
+
+                    void
+                    AddString(char const* data, std::size_t size)
+                    {
+                        AddTag('s');
+                        AddNumber(static_cast<long long>(size));
+                        Add(data, size);
+                    }
+
+                    std::uint64_t
+                    Value() const
+                    {
+                        return hash;
+                    }
+
+                  private:
+                    void
+                    Add(char const* data, std::size_t size)
+                    {
+                        for (std::size_t i = 0; i < size; ++i)
+                        {
+                            hash ^= static_cast<unsigned char>(data[i]);
+                            hash *= 1099511628211ULL;
+                        }
+                    }
+
+                    std::uint64_t hash = 14695981039346656037ULL;
+                };
+
+                using GetComponentMetadataTableFn = ComponentMetadataTable const* (*)();
+
+            } // namespace detail
+        }     // namespace component
+    }         // namespace service
+} // namespace cppmicroservices
+
+#endif // ComponentMetadataTable_hpp
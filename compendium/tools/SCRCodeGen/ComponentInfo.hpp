@@ -55,6 +55,15 @@ namespace codegen
             bool injectReferences = false;
             ServiceInfo service;
             std::vector<ReferenceInfo> references;
+            // The following members hold the values the declarative services runtime
+            // derives from the manifest and are only used for the precompiled metadata.
+            bool enabled = true;
+            bool immediate = false;
+            std::vector<std::string> configurationPids;
+            std::string factoryComponentID;
+            // false if the runtime would interpret the manifest of this component in
+            // a way the precompiled metadata cannot express (e.g. it rejects it)
+            bool precompilable = true;
             static const std::string CONFIG_POLICY_IGNORE;
             static const std::string CONFIG_POLICY_REQUIRE;
             static const std::string CONFIG_POLICY_OPTIONAL;
@@ -0,0 +1,245 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+  =============================================================================*/
+#ifndef COMPONENTMETADATATABLEGENERATOR_HPP
+#define COMPONENTMETADATATABLEGENERATOR_HPP
+
+#include <algorithm>
+#include <ios>
+#include <sstream>
+
+#include "ComponentInfo.hpp"
+#include "Util.hpp"
+#include "cppmicroservices/servicecomponent/detail/ComponentMetadataTable.hpp"
+
+using codegen::datamodel::ComponentInfo;
+
+namespace codegen
+{
+
+    // Generates the precompiled component metadata table of a bundle. The declarative
+    // services runtime reads the table instead of parsing the "scr" manifest when the
+    // bundle binary is already loaded.
+    // The generated code is meant to be appended to the output of the
+    // ComponentCallbackGenerator. Nothing is generated if the runtime would interpret
+    // the manifest of any component differently than the table would describe it.
+    class ComponentMetadataTableGenerator
+    {
+      public:
+        // scr is the "scr" manifest section componentInfos were parsed from.
+        ComponentMetadataTableGenerator(Json::Value const& scr, std::vector<ComponentInfo> const& componentInfos)
+            : mManifestHash(HashScr(scr))
+            , mComponentInfos(componentInfos)
+            , mStrStream()
+        {
+            if (std::all_of(mComponentInfos.begin(),
+                            mComponentInfos.end(),
+                            [](ComponentInfo const& info) { return info.precompilable; }))
+            {
+                Substitute();
+            }
+        }
+
+        std::string
+        GetString() const
+        {
+            return mStrStream.str();
+        }
+
+      private:
+        void
+        Substitute()
+        {
+            mStrStream << std::endl
+                       << "#if defined(US_BUNDLE_NAME)" << std::endl
+                       << R"(#include "cppmicroservices/servicecomponent/detail/ComponentMetadataTable.hpp")"
+                       << std::endl
+                       << std::endl
+                       << "namespace" << std::endl
+                       << "{" << std::endl;
+
+            for (std::size_t i = 0; i < mComponentInfos.size(); ++i)
+            {
+                SubstituteArrays(i, mComponentInfos[i]);
+            }
+
+            mStrStream << std::endl << "  scd::ComponentMetadataEntry const components[] = {" << std::endl;
+            for (std::size_t i = 0; i < mComponentInfos.size(); ++i)
+            {
+                SubstituteComponent(i, mComponentInfos[i]);
+            }
+            mStrStream << "  };" << std::endl
+                       << std::endl
+                       << "  scd::ComponentMetadataTable const componentMetadataTable = "
+                       << "{ scd::COMPONENT_METADATA_TABLE_VERSION, 0x" << std::hex << mManifestHash << std::dec
+                       << "ULL, components, " << mComponentInfos.size() << " };"
+                       << std::endl
+                       << "}" << std::endl
+                       << std::endl
+                       << "extern \"C\" US_ABI_EXPORT scd::ComponentMetadataTable const* "
+                       << "US_CONCAT(US_SCR_METADATA_TABLE_PREFIX, US_BUNDLE_NAME)()" << std::endl
+                       << "{" << std::endl
+                       << "  return &componentMetadataTable;" << std::endl
+                       << "}" << std::endl
+                       << "#endif" << std::endl;
+        }
+
+        static std::uint64_t
+        HashScr(Json::Value const& scr)
+        {
+            cppmicroservices::service::component::detail::ManifestHash hash;
+            HashValue(hash, scr);
+            return hash.Value();
+        }
+
+        // Feeds value to hash in the canonical form the runtime uses for the manifest
+        // it parsed, see ManifestHash.
+        static void
+        HashValue(cppmicroservices::service::component::detail::ManifestHash& hash, Json::Value const& value)
+        {
+            if (value.isObject())
+            {
+                auto names = value.getMemberNames();
+                names.erase(std::remove_if(names.begin(),
+                                           names.end(),
+                                           [&value](std::string const& name) { return value[name].isNull(); }),
+                            names.end());
+                std::sort(names.begin(), names.end());
+                hash.AddTag('o');
+                hash.AddNumber(static_cast<long long>(names.size()));
+                for (auto const& name : names)
+                {
+                    hash.AddString(name.data(), name.size());
+                    HashValue(hash, value[name]);
+                }
+            }
+            else if (value.isArray())
+            {
+                auto const size = std::count_if(value.begin(),
+                                                value.end(),
+                                                [](Json::Value const& element) { return !element.isNull(); });
+                hash.AddTag('a');
+                hash.AddNumber(static_cast<long long>(size));
+                for (auto const& element : value)
+                {
+                    if (!element.isNull())
+                    {
+                        HashValue(hash, element);
+                    }
+                }
+            }
+            else if (value.isString())
+            {
+                // the runtime removes a leading '%' from strings
+                auto str = value.asString();
+                if (!str.empty() && str[0] == '%')
+                {
+                    str.erase(0, 1);
+                }
+                hash.AddString(str.data(), str.size());
+            }
+            else if (value.isBool())
+            {
+                hash.AddTag(value.asBool() ? 't' : 'f');
+            }
+            else if (value.isInt() && value.type() != Json::ValueType::realValue)
+            {
+                hash.AddTag('i');
+                hash.AddNumber(value.asInt());
+            }
+            else
+            {
+                hash.AddTag('?');
+            }
+        }
+
+        void
+        SubstituteStrings(std::string const& arrayName, std::vector<std::string> const& strings)
+        {
+            if (strings.empty())
+            {
+                return;
+            }
+            mStrStream << "  char const* const " << arrayName << "[] = { ";
+            auto sep = "";
+            for (auto const& str : strings)
+            {
+                mStrStream << sep << util::ToCppStringLiteral(str);
+                sep = ", ";
+            }
+            mStrStream << " };" << std::endl;
+        }
+
+        void
+        SubstituteArrays(std::size_t index, ComponentInfo const& componentInfo)
+        {
+            auto const suffix = std::to_string(index);
+            SubstituteStrings("configurationPids_" + suffix, componentInfo.configurationPids);
+            SubstituteStrings("serviceInterfaces_" + suffix, componentInfo.service.interfaces);
+            if (!componentInfo.references.empty())
+            {
+                mStrStream << "  scd::ReferenceMetadataEntry const references_" << suffix << "[] = {" << std::endl;
+                for (auto const& ref : componentInfo.references)
+                {
+                    mStrStream << "    { " << util::ToCppStringLiteral(ref.name) << ", "
+                               << util::ToCppStringLiteral(ref.interface) << ", "
+                               << util::ToCppStringLiteral(ref.cardinality) << ", "
+                               << util::ToCppStringLiteral(ref.policy) << ", "
+                               << util::ToCppStringLiteral(ref.policy_option) << ", "
+                               << util::ToCppStringLiteral(ref.target) << " }," << std::endl;
+                }
+                mStrStream << "  };" << std::endl;
+            }
+        }
+
+        void
+        SubstituteComponent(std::size_t index, ComponentInfo const& componentInfo)
+        {
+            auto const suffix = std::to_string(index);
+            auto arrayOrNull = [&suffix](std::string const& arrayName, std::size_t size)
+            { return size ? arrayName + "_" + suffix : std::string("nullptr"); };
+
+            auto const& name = componentInfo.name.empty() ? componentInfo.implClassName : componentInfo.name;
+            auto const& scope = componentInfo.service.scope.empty() ? std::string("singleton")
+                                                                    : componentInfo.service.scope;
+            auto const& pids = componentInfo.configurationPids;
+            auto const& interfaces = componentInfo.service.interfaces;
+            auto const& refs = componentInfo.references;
+
+            mStrStream << "    { " << util::ToCppStringLiteral(name) << ", "
+                       << util::ToCppStringLiteral(componentInfo.implClassName) << ", "
+                       << (componentInfo.enabled ? "true" : "false") << ", "
+                       << (componentInfo.immediate ? "true" : "false") << ", "
+                       << util::ToCppStringLiteral(componentInfo.configurationPolicy) << ", "
+                       << arrayOrNull("configurationPids", pids.size()) << ", " << pids.size() << ", "
+                       << util::ToCppStringLiteral(componentInfo.factoryComponentID) << ", "
+                       << util::ToCppStringLiteral(scope) << ", "
+                       << arrayOrNull("serviceInterfaces", interfaces.size()) << ", " << interfaces.size() << ", "
+                       << arrayOrNull("references", refs.size()) << ", " << refs.size() << " }," << std::endl;
+        }
+
+        const std::uint64_t mManifestHash;
+        const std::vector<ComponentInfo> mComponentInfos;
+        std::stringstream mStrStream;
+    };
+
+} // namespace codegen
+#endif
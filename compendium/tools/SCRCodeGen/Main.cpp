@@ -40,9 +40,11 @@
 #    define FRIEND_TEST(x, y)
 #endif
 #include "ComponentCallbackGenerator.hpp"
+#include "ComponentMetadataTableGenerator.hpp"
 #include "ComponentInfo.hpp"
 #include "Util.hpp"
 using codegen::ComponentCallbackGenerator;
+using codegen::ComponentMetadataTableGenerator;
 using codegen::util::JsonValueValidator;
 using codegen::util::ParseManifestOrThrow;
 using codegen::util::WriteToFile;
@@ -111,7 +113,8 @@ main(int argc, char const** argv, char**)
         auto const manifestParser = ManifestParserFactory::Create(version.asInt());
         auto const componentInfos = manifestParser->ParseAndGetComponentInfos(scr);
         ComponentCallbackGenerator compGen(includeHeaderPaths, componentInfos);
-        WriteToFile(outFilePath, compGen.GetString());
+        ComponentMetadataTableGenerator tableGen(scr, componentInfos);
+        WriteToFile(outFilePath, compGen.GetString() + tableGen.GetString());
     }
     catch (std::exception const& ex)
     {
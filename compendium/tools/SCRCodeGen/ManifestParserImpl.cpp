@@ -22,12 +22,42 @@
 #include "ManifestParserImpl.hpp"
 #include "Util.hpp"
 
+#include <algorithm>
+#include <cctype>
 #include <unordered_map>
 
 using codegen::datamodel::ComponentInfo;
 using codegen::datamodel::ReferenceInfo;
 using codegen::util::JsonValueValidator;
 
+namespace
+{
+    // The code generator accepts the values of enumerated names in any case while the
+    // declarative services runtime only accepts them in lower case.
+    bool
+    IsLowerCase(std::string const& value)
+    {
+        return std::none_of(value.begin(), value.end(), [](unsigned char c) { return std::isupper(c); });
+    }
+
+    // Reads the optional boolean data[name] into target the way the declarative services
+    // runtime does. Returns false if the runtime would reject the value.
+    bool
+    AssignOptionalBool(Json::Value const& data, char const* name, bool& target)
+    {
+        if (!data.isMember(name))
+        {
+            return true;
+        }
+        if (!data[name].isBool())
+        {
+            return false;
+        }
+        target = data[name].asBool();
+        return true;
+    }
+} // namespace
+
 std::vector<ComponentInfo>
 ManifestParserImplV1::ParseAndGetComponentInfos(Json::Value const& scr) const
 {
@@ -46,6 +76,8 @@ ManifestParserImplV1::ParseAndGetComponentInfos(Json::Value const& scr) const
         }
         catch (std::exception const&)
         {
+            // the runtime rejects a component with an empty or non-string name
+            componentInfo.precompilable = !jsonComponent.isMember("name");
         }
 
         // inject-references
@@ -69,6 +101,7 @@ ManifestParserImplV1::ParseAndGetComponentInfos(Json::Value const& scr) const
             };
             componentInfo.configurationPolicy
                 = JsonValueValidator(jsonComponent, "configuration-policy", policyChoices).GetString();
+            componentInfo.precompilable &= IsLowerCase(componentInfo.configurationPolicy);
         }
         std::unordered_map<std::string, std::string> duplicatePids;
         if (jsonComponent.isMember("configuration-pid"))
@@ -88,6 +121,7 @@ ManifestParserImplV1::ParseAndGetComponentInfos(Json::Value const& scr) const
                     throw std::runtime_error(msg);
                 }
                 duplicatePids.emplace(pid.asString(), pid.asString());
+                componentInfo.configurationPids.push_back(pid.asString());
             }
         }
         // Both configuration-policy and configuration-pid must be present in the manifest.json
@@ -109,6 +143,7 @@ ManifestParserImplV1::ParseAndGetComponentInfos(Json::Value const& scr) const
                 throw std::runtime_error("Error: For factory components, the configuration-pid array "
                         "may only contain one entry");
             }
+            componentInfo.factoryComponentID = factoryComponentID;
         }
 
         // service
@@ -119,6 +154,7 @@ ManifestParserImplV1::ParseAndGetComponentInfos(Json::Value const& scr) const
                 {"singleton", "bundle", "prototype"}
             };
             componentInfo.service.scope = JsonValueValidator(jsonServiceInfo, "scope", scopeChoices).GetString();
+            componentInfo.precompilable &= IsLowerCase(componentInfo.service.scope);
 
             // interfaces
             auto const jsonServiceInterfaces
@@ -169,6 +205,8 @@ ManifestParserImplV1::ParseAndGetComponentInfos(Json::Value const& scr) const
                     refInfo.target
                         = JsonValueValidator(jsonRefInfo, "target", Json::ValueType::stringValue).GetString();
                 }
+                componentInfo.precompilable &= IsLowerCase(refInfo.cardinality) && IsLowerCase(refInfo.policy)
+                                               && IsLowerCase(refInfo.policy_option);
                 componentInfo.references.push_back(refInfo);
             }
 
@@ -189,6 +227,30 @@ ManifestParserImplV1::ParseAndGetComponentInfos(Json::Value const& scr) const
                 throw std::invalid_argument(exceptionMessage);
             }
         }
+
+        // enabled and immediate, resolved the way the runtime does
+        bool const serviceSpecified = jsonComponent.isMember("service");
+        bool isImmediate = !serviceSpecified;
+        componentInfo.precompilable &= AssignOptionalBool(jsonComponent, "enabled", componentInfo.enabled)
+                                       && AssignOptionalBool(jsonComponent, "immediate", isImmediate)
+                                       && (serviceSpecified || isImmediate);
+        componentInfo.immediate = !serviceSpecified || isImmediate;
+
+        // the runtime replaces the configuration pid "$" with the component name and
+        // ignores the pids if the configuration policy is "ignore"
+        if (componentInfo.configurationPolicy == codegen::datamodel::ComponentInfo::CONFIG_POLICY_IGNORE)
+        {
+            componentInfo.configurationPids.clear();
+        }
+        auto const& componentName = componentInfo.name.empty() ? componentInfo.implClassName : componentInfo.name;
+        std::replace(componentInfo.configurationPids.begin(),
+                     componentInfo.configurationPids.end(),
+                     std::string("$"),
+                     componentName);
+        auto sortedPids = componentInfo.configurationPids;
+        std::sort(sortedPids.begin(), sortedPids.end());
+        componentInfo.precompilable &= std::adjacent_find(sortedPids.begin(), sortedPids.end()) == sortedPids.end();
+
         componentInfos.push_back(componentInfo);
     }
     return componentInfos;
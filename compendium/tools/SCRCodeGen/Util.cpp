@@ -21,6 +21,8 @@
   =============================================================================*/
 #include "Util.hpp"
 
+#include <iomanip>
+
 namespace codegen
 {
     namespace util
@@ -52,5 +54,44 @@ namespace codegen
             fileStream << content;
             fileStream.close();
         }
+
+        std::string
+        ToCppStringLiteral(std::string const& value)
+        {
+            std::ostringstream literal;
+            literal << '"';
+            for (unsigned char c : value)
+            {
+                switch (c)
+                {
+                    case '"':
+                        literal << "\\\"";
+                        break;
+                    case '\\':
+                        literal << "\\\\";
+                        break;
+                    case '\n':
+                        literal << "\\n";
+                        break;
+                    case '\t':
+                        literal << "\\t";
+                        break;
+                    default:
+                        if (c < 0x20 || c >= 0x7f)
+                        {
+                            // octal escapes are never continued by the next character if
+                            // they have three digits
+                            literal << '\\' << std::oct << std::setw(3) << std::setfill('0')
+                                    << static_cast<unsigned int>(c) << std::dec;
+                        }
+                        else
+                        {
+                            literal << c;
+                        }
+                }
+            }
+            literal << '"';
+            return literal.str();
+        }
     } // namespace util
 } // namespace codegen
@@ -201,6 +201,9 @@ namespace codegen
         // Throw if the file can't be opened.
         void WriteToFile(std::string const& filePath, std::string const& content);
 
+        // Return value as a C++ string literal, including the enclosing quotes.
+        std::string ToCppStringLiteral(std::string const& value);
+
         namespace detail
         {
             inline void
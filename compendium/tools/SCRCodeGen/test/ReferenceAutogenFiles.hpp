@@ -201,6 +201,32 @@ extern "C" US_ABI_EXPORT void DeleteInstance_DSSpellCheck_SpellCheckImpl(scd::Co
   delete componentInstance;
 }
 
+)manifestsrc";
+
+    const std::string REF_TABLE = R"manifestsrc(
+#if defined(US_BUNDLE_NAME)
+#include "cppmicroservices/servicecomponent/detail/ComponentMetadataTable.hpp"
+
+namespace
+{
+  char const* const configurationPids_0[] = { "DSSpellCheck::SpellCheckImpl" };
+  char const* const serviceInterfaces_0[] = { "SpellCheck::ISpellCheckService" };
+  scd::ReferenceMetadataEntry const references_0[] = {
+    { "dictionary", "DictionaryService::IDictionaryService", "1..1", "static", "reluctant", "" },
+  };
+
+  scd::ComponentMetadataEntry const components[] = {
+    { "DSSpellCheck::SpellCheckImpl", "DSSpellCheck::SpellCheckImpl", true, false, "require", configurationPids_0, 1, "factory id", "singleton", serviceInterfaces_0, 1, references_0, 1 },
+  };
+
+  scd::ComponentMetadataTable const componentMetadataTable = { scd::COMPONENT_METADATA_TABLE_VERSION, 0xdcbfb42762cda1efULL, components, 1 };
+}
+
+extern "C" US_ABI_EXPORT scd::ComponentMetadataTable const* US_CONCAT(US_SCR_METADATA_TABLE_PREFIX, US_BUNDLE_NAME)()
+{
+  return &componentMetadataTable;
+}
+#endif
 )manifestsrc";
 
 } // namespace codegen
@@ -23,6 +23,7 @@
 #include <regex>
 
 #include "../ComponentCallbackGenerator.hpp"
+#include "../ComponentMetadataTableGenerator.hpp"
 #include "../ManifestParser.hpp"
 #include "../ManifestParserFactory.hpp"
 #include "ReferenceAutogenFiles.hpp"
@@ -662,6 +663,93 @@ namespace codegen
                 REF_MULT_COMPS_SAME_IMPL),
             CodegenValidManifestState(manifest_multiple_cardinality_ref, { "SpellCheckerImpl.hpp" }, REF_MULT_CARD)));
 
+    std::string
+    GetMetadataTable(std::string const& manifest)
+    {
+        auto scr = GetManifestSCRData(manifest);
+        auto version = util::JsonValueValidator(scr, "version", Json::ValueType::intValue)();
+        auto manifestParser = ManifestParserFactory::Create(version.asInt());
+        return ComponentMetadataTableGenerator(scr, manifestParser->ParseAndGetComponentInfos(scr)).GetString();
+    }
+
+    TEST(ComponentMetadataTableTest, TestTableGeneration)
+    {
+        EXPECT_EQ(GetMetadataTable(manifest_json), REF_TABLE);
+
+        // the table holds the values the runtime derives from the manifest
+        auto const table = GetMetadataTable(R"manifest(
+  {
+    "scr" : { "version" : 1,
+              "components": [{
+                       "implementation-class": "Foo::Impl1",
+                       "name": "Foo",
+                       "configuration-policy" : "optional",
+                       "configuration-pid" : ["$", "Bar"],
+                       "references": [{
+                         "name": "dictionary",
+                         "interface": "DictionaryService::IDictionaryService",
+                         "target": "(lang=\"en\")"
+                       }]
+                       }]
+            }
+  }
+  )manifest");
+        EXPECT_THAT(table, ::testing::HasSubstr(R"(configurationPids_0[] = { "Foo", "Bar" };)"));
+        EXPECT_THAT(table, ::testing::HasSubstr(R"x("reluctant", "(lang=\"en\")" },)x"));
+        EXPECT_THAT(table, ::testing::HasSubstr(R"({ "Foo", "Foo::Impl1", true, true, "optional",)"));
+    }
+
+    TEST(ComponentMetadataTableTest, TestManifestHash)
+    {
+        // The declarative services runtime computes the same hash for this manifest from
+        // the AnyMap it parses, see MetadataParserImplV1Test.HashScrMetadata. Member order,
+        // whitespace and null values do not change the hash.
+        auto const table = GetMetadataTable(R"manifest(
+  {
+    "scr" : { "components": [{
+                "references": [{ "interface": "DictionaryService::IDictionaryService",
+                                 "name": "dictionary" }],
+                "service": { "interfaces": ["SpellCheck::ISpellCheckService"], "scope": "singleton" },
+                "implementation-class": "DSSpellCheck::SpellCheckImpl",
+                "unused": null
+              }],
+              "version" : 1 }
+  }
+  )manifest");
+        EXPECT_THAT(table, ::testing::HasSubstr("COMPONENT_METADATA_TABLE_VERSION, 0x480ac4412dbe6739ULL, components, 1 };"));
+
+        auto const otherTable = GetMetadataTable(R"manifest(
+  {
+    "scr" : { "version" : 1,
+              "components": [{
+                "implementation-class": "DSSpellCheck::SpellCheckImpl",
+                "properties": { "foo": "bar" }
+              }]
+            }
+  }
+  )manifest");
+        EXPECT_THAT(otherTable, ::testing::Not(::testing::HasSubstr("0x480ac4412dbe6739ULL")));
+    }
+
+    TEST(ComponentMetadataTableTest, TestNoTableForValuesInterpretedAtRuntime)
+    {
+        // the runtime keeps the upper case scope
+        EXPECT_TRUE(GetMetadataTable(manifest_dyn).empty());
+
+        // the runtime rejects a component that is neither immediate nor provides a service
+        EXPECT_TRUE(GetMetadataTable(R"manifest(
+  {
+    "scr" : { "version" : 1,
+              "components": [{
+                       "implementation-class": "Foo::Impl1",
+                       "immediate": false
+                       }]
+            }
+  }
+  )manifest")
+                        .empty());
+    }
+
     // For the manifest specified in the member manifest, we expect the exception message
     // output by the code-generator to be exactly errorOutput.
     // Instead, if we expect the errorOutput to be contained in the generated error message,
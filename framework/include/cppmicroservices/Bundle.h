@@ -219,8 +219,8 @@ namespace cppmicroservices
              * activation policy.
              *
              * @see Constants#BUNDLE_ACTIVATIONPOLICY
+             * @see Constants#FRAMEWORK_BUNDLE_LAZY_ACTIVATION
              * @see #Start(uint32_t)
-             * @note This option is reserved for future use and not supported yet.
              */
             START_ACTIVATION_POLICY = 0x00000002
         };
@@ -640,15 +640,20 @@ namespace cppmicroservices
          * -# If this bundle's state is not \c STATE_RESOLVED, an attempt is made to
          *    resolve this bundle. If the Framework cannot resolve this bundle, a
          *    \c std::runtime_error is thrown.
-         * -# If the {@link #START_ACTIVATION_POLICY} option is set and this
-         *    bundle's declared activation policy is {@link Constants#ACTIVATION_LAZY
-         *    lazy} then:
+         * -# If the {@link #START_ACTIVATION_POLICY} option is set, or the
+         *    {@link Constants#FRAMEWORK_BUNDLE_LAZY_ACTIVATION} framework property
+         *    is \c true, and this bundle's declared activation policy is
+         *    {@link Constants#ACTIVATION_LAZY lazy} then:
          *    - If this bundle's state is \c STATE_STARTING, then this method returns
          *      immediately.
          *    - This bundle's state is set to \c STATE_STARTING.
          *    - A bundle event of type {@link BundleEvent#BUNDLE_LAZY_ACTIVATION} is fired.
          *    - This method returns immediately and the remaining steps will be
-         *      followed when this bundle's activation is later triggered.
+         *      followed when a service registered with this bundle's context is
+         *      first retrieved from its service factory. Failures are then reported
+         *      as {@link FrameworkEvent#FRAMEWORK_ERROR} events. Starting the bundle
+         *      without the activation policy before then follows the remaining
+         *      steps right away.
          * -# This bundle's state is set to \c STATE_STARTING.
          * -# A bundle event of type {@link BundleEvent#BUNDLE_STARTING} is fired.
          * -# If the bundle is contained in a shared library, the library is loaded
@@ -154,9 +154,9 @@ namespace cppmicroservices
              * <p>
              * The bundle has a \link Constants#ACTIVATION_LAZY lazy activation policy\endlink
              * and is waiting to be activated. It is now in the \link Bundle::STATE_STARTING
-             * BUNDLE_STARTING\endlink state and has a valid \c BundleContext.
-             *
-             * @note This identifier is reserved for future use and not supported yet.
+             * BUNDLE_STARTING\endlink state and has a valid \c BundleContext. Its
+             * library is not loaded until the activation is triggered, which is
+             * followed by {@link #BUNDLE_STARTING} and {@link #BUNDLE_STARTED} events.
              */
             BUNDLE_LAZY_ACTIVATION = 0x00000200
         };
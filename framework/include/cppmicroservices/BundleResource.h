@@ -35,6 +35,7 @@ namespace cppmicroservices
 {
 
     class BundleResourcePrivate;
+    class BundleResourceReader;
     struct BundleArchive;
 
     /**
@@ -273,6 +274,9 @@ namespace cppmicroservices
         /**
          * Returns the (uncompressed) size of the resource data for this %BundleResource object.
          *
+         * Sizes which do not fit into an \c int are reported as \c INT_MAX. Such
+         * resources can still be read completely with a BundleResourceStream.
+         *
          * @return The uncompressed resource data size.
          */
         int GetSize() const;
@@ -280,6 +284,8 @@ namespace cppmicroservices
         /**
          * Returns the compressed size of the resource data for this %BundleResource object.
          *
+         * Sizes which do not fit into an \c int are reported as \c INT_MAX.
+         *
          * @return The compressed resource data size.
          */
         int GetCompressedSize() const;
@@ -317,6 +323,8 @@ namespace cppmicroservices
 
         std::unique_ptr<void, void (*)(void*)> GetData() const;
 
+        std::unique_ptr<BundleResourceReader> GetReader() const;
+
         std::shared_ptr<BundleResourcePrivate> d;
     };
 
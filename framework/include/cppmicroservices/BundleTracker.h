@@ -27,6 +27,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <stdexcept>
 #include <type_traits>
 #include <vector>
 
@@ -216,11 +217,7 @@ namespace cppmicroservices
             { /* If BundleTracker is not open */
                 return bundles;
             }
-            {
-                auto l = t->Lock();
-                US_UNUSED(l);
-                d->GetBundles_unlocked(bundles, t.get());
-            }
+            d->GetBundles(bundles, t.get());
             return bundles;
         }
 
@@ -252,18 +249,31 @@ namespace cppmicroservices
         TrackingMap
         GetTracked() const noexcept
         {
-            BundleTracker<T>::TrackingMap trackingMap;
             auto t = d->Tracked();
             if (!t)
             { /* If BundleTracker is not open */
-                return trackingMap;
+                return TrackingMap();
             }
-            {
-                auto l = t->Lock();
-                US_UNUSED(l);
-                t->CopyEntries_unlocked(trackingMap);
+            return *t->GetSnapshot();
+        }
+
+        /**
+         * Returns an immutable snapshot of all of the currently tracked Bundles and their custom objects.
+         *
+         * Unlike GetTracked(), this does not copy the map. The snapshot is shared by all callers until
+         * the set of tracked bundles changes, so repeated reads of an unchanged tracker do not take a lock.
+         *
+         * @return The Bundles currently tracked by this <code>BundleTracker</code> with their custom objects.
+         */
+        std::shared_ptr<TrackingMap const>
+        GetTrackedSnapshot() const
+        {
+            auto t = d->Tracked();
+            if (!t)
+            { /* If BundleTracker is not open */
+                return std::make_shared<TrackingMap const>();
             }
-            return trackingMap;
+            return t->GetSnapshot();
         }
 
         /**
@@ -356,6 +366,54 @@ namespace cppmicroservices
             t->TrackInitial();
         }
 
+        /**
+         * Start batching bundle events.
+         *
+         * Until the matching EndBatch() call, bundle events are queued instead of being delivered to the
+         * customizer, keeping only the last event of each <code>Bundle</code>. Calls can be nested.
+         * Use this around bursts of bundle state changes, such as installing and starting many bundles.
+         *
+         * @see EndBatch()
+         */
+        void
+        BeginBatch() noexcept
+        {
+            ++d->batchDepth;
+        }
+
+        /**
+         * Stop batching bundle events.
+         *
+         * When the last nested batch ends, the queued bundles are added, modified or removed according
+         * to their current state with a single BundleTrackerCustomizer::BundlesChanged call.
+         * Events queued while the <code>BundleTracker</code> is closed are discarded.
+         *
+         * @throws std::logic_error If there is no matching BeginBatch() call.
+         * @throws Any exception thrown by the customizer.
+         *
+         * @see BeginBatch()
+         */
+        void
+        EndBatch()
+        {
+            int depth = d->batchDepth.load();
+            do
+            {
+                if (depth <= 0)
+                {
+                    throw std::logic_error("EndBatch() called without a matching BeginBatch()");
+                }
+            } while (!d->batchDepth.compare_exchange_weak(depth, depth - 1));
+
+            if (depth == 1)
+            {
+                if (auto t = d->Tracked())
+                {
+                    t->FlushBatch();
+                }
+            }
+        }
+
         /**
          * Remove a bundle from this <code>BundleTracker</code>.
          *
@@ -460,6 +518,24 @@ namespace cppmicroservices
             /* do nothing */
         }
 
+        /**
+         * Called once for all bundle changes coalesced between BeginBatch() and EndBatch().
+         *
+         * The default, uncustomized behavior is to call RemovedBundle, ModifiedBundle and AddingBundle
+         * for each change.
+         *
+         * @param changes The bundles being added, modified and removed, each with its final event.
+         *
+         * @return The object to be tracked, or std::nullopt, for each entry of <code>changes.adding</code>.
+         *
+         * @see BundleTrackerCustomizer::BundlesChanged(BundleTrackerChanges<T>)
+         */
+        virtual std::vector<std::optional<T>>
+        BundlesChanged(BundleTrackerChanges<T> const& changes) override
+        {
+            return BundleTrackerCustomizer<T>::BundlesChanged(changes);
+        }
+
       private:
         friend class detail::TrackedBundle<T>;
         friend class detail::BundleTrackerPrivate<T>;
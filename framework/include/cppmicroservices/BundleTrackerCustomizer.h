@@ -24,12 +24,48 @@
 #define CPPMICROSERVICES_BUNDLETRACKERCUSTOMIZER_H
 
 #include "cppmicroservices/Bundle.h"
+#include "cppmicroservices/BundleEvent.h"
+
 #include <optional>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace cppmicroservices
 {
 
+    /**
+     * \ingroup MicroServices
+     * \ingroup gr_bundletracker
+     *
+     * The coalesced bundle changes delivered to BundleTrackerCustomizer::BundlesChanged when a
+     * <code>BundleTracker</code> batch is flushed. Each <code>Bundle</code> appears at most once,
+     * together with the last <code>BundleEvent</code> received for it during the batch.
+     *
+     * @tparam T The type of the tracked object. Defaults to <code>Bundle</code>.
+     * @see BundleTracker::BeginBatch()
+     */
+    template <class T = Bundle>
+    struct BundleTrackerChanges
+    {
+        /**
+         * Events of the bundles which are not tracked and whose final state is covered by the state mask.
+         */
+        std::vector<BundleEvent> adding;
+
+        /**
+         * Events of the tracked bundles whose final state is covered by the state mask, with their
+         * tracked objects.
+         */
+        std::vector<std::pair<BundleEvent, T>> modified;
+
+        /**
+         * Events of the tracked bundles whose final state is not covered by the state mask, with their
+         * tracked objects. These bundles are no longer tracked.
+         */
+        std::vector<std::pair<BundleEvent, T>> removed;
+    };
+
     /**
      * \ingroup MicroServices
      * \ingroup gr_bundletracker
@@ -115,6 +151,40 @@ namespace cppmicroservices
          * @param object The tracked object corresponding to the tracked <code>Bundle</code>
          */
         virtual void RemovedBundle(Bundle const& bundle, BundleEvent const& event, T const& object) = 0;
+
+        /**
+         * Called once for all bundle changes coalesced while a <code>BundleTracker</code> was batching
+         * events, instead of one AddingBundle, ModifiedBundle or RemovedBundle call per event.
+         *
+         * The default implementation calls RemovedBundle, ModifiedBundle and AddingBundle for each change,
+         * in that order.
+         *
+         * @param changes The bundles being added, modified and removed, each with its final event.
+         *
+         * @return The object to be tracked, or std::nullopt, for each entry of <code>changes.adding</code>,
+         * in the same order.
+         *
+         * @see BundleTracker::BeginBatch()
+         */
+        virtual std::vector<std::optional<T>>
+        BundlesChanged(BundleTrackerChanges<T> const& changes)
+        {
+            for (auto const& [event, object] : changes.removed)
+            {
+                RemovedBundle(event.GetBundle(), event, object);
+            }
+            for (auto const& [event, object] : changes.modified)
+            {
+                ModifiedBundle(event.GetBundle(), event, object);
+            }
+            std::vector<std::optional<T>> objects;
+            objects.reserve(changes.adding.size());
+            for (auto const& event : changes.adding)
+            {
+                objects.push_back(AddingBundle(event.GetBundle(), event));
+            }
+            return objects;
+        }
     };
 
 } // namespace cppmicroservices
@@ -182,9 +182,12 @@ namespace cppmicroservices
          * library containing it is loaded into memory.
          *
          * A bundle with the lazy activation policy that is started with the
-         * {@link Bundle#START_ACTIVATION_POLICY START_ACTIVATION_POLICY} option
-         * will wait in the {@link Bundle#STATE_STARTING STATE_STARTING} state until its
-         * library is loaded. The bundle will then be activated.
+         * {@link Bundle#START_ACTIVATION_POLICY START_ACTIVATION_POLICY} option,
+         * or while #FRAMEWORK_BUNDLE_LAZY_ACTIVATION is set, will wait in the
+         * {@link Bundle#STATE_STARTING STATE_STARTING} state without loading its
+         * library. The library is loaded and the bundle is activated when a
+         * service registered with the bundle's context is first retrieved from its
+         * service factory, as done for Declarative Services components.
          *
          * The activation policy value is specified as in the
          * bundle.activation_policy manifest header like:
@@ -317,6 +320,85 @@ namespace cppmicroservices
         US_Framework_EXPORT extern const std::string
             FRAMEWORK_BUNDLE_VALIDATION_FUNC; // = "org.cppmicroservices.framework.bundle.validation.function"
 
+        /**
+         * Framework launching property specifying whether the shared libraries of
+         * installed bundles are preloaded in the background, before the bundles are
+         * started. The value must be a <code>std::string</code>.
+         *
+         * If this property is not set, or set to an unknown value, bundle shared
+         * libraries are loaded synchronously when the bundle is started.
+         *
+         * Preloads run on at most <code>std::thread::hardware_concurrency()</code>
+         * background threads, however many bundles are installed at once.
+         *
+         * @see #FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_PREFETCH
+         * @see #FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_LOAD
+         */
+        US_Framework_EXPORT extern const std::string
+            FRAMEWORK_BUNDLE_LIBRARY_PRELOAD; // = "org.cppmicroservices.framework.bundle.library.preload"
+
+        /**
+         * Specifies that the file of a bundle's shared library is read once on a
+         * background thread when the bundle is installed, so that its pages are
+         * already in the operating system's file cache when the bundle is started.
+         * The library itself is still loaded when the bundle is started.
+         */
+        US_Framework_EXPORT extern const std::string FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_PREFETCH; // = "prefetch";
+
+        /**
+         * Specifies that a bundle's shared library is loaded and its activator
+         * symbols are resolved on a background thread when the bundle is installed.
+         * Starting the bundle waits for the background load to finish and reuses
+         * its result.
+         *
+         * If a #FRAMEWORK_BUNDLE_VALIDATION_FUNC is set, libraries are never loaded
+         * before they have been validated and this value behaves like
+         * #FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_PREFETCH.
+         */
+        US_Framework_EXPORT extern const std::string FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_LOAD; // = "load";
+
+        /**
+         * Framework launching property specifying whether bundles declaring the
+         * {@link #ACTIVATION_LAZY lazy} activation policy are always started
+         * according to it, as if {@link Bundle#START_ACTIVATION_POLICY
+         * START_ACTIVATION_POLICY} was passed to Bundle::Start. The value must be
+         * a <code>bool</code>. The default is <code>false</code>.
+         *
+         * @see #BUNDLE_ACTIVATIONPOLICY
+         */
+        US_Framework_EXPORT extern const std::string
+            FRAMEWORK_BUNDLE_LAZY_ACTIVATION; // = "org.cppmicroservices.framework.bundle.lazy_activation"
+
+        /**
+         * Framework launching property specifying a file to which a startup
+         * profile is written when the framework stops. The value must be a
+         * <code>std::string</code>.
+         *
+         * If set, the framework records timed spans for bundle installation,
+         * manifest parsing, shared library loading, bundle activator calls and
+         * service event delivery. Declarative Services and Configuration Admin
+         * add spans for component activation and configuration updates. The
+         * file is written in the Chrome trace event format.
+         *
+         * Tracing is process wide: the file contains the spans of all threads,
+         * including those of other frameworks traced at the same time. Each
+         * thread records at most 65536 spans; later spans are dropped and
+         * their number is written to the file.
+         */
+        US_Framework_EXPORT extern const std::string
+            FRAMEWORK_TRACE_FILE; // = "org.cppmicroservices.framework.trace.file"
+
+        /**
+         * Framework launching property specifying whether the locks guarding
+         * the framework's internal data structures are profiled while the
+         * framework is running. The value must be a <code>bool</code>. The
+         * default is <code>false</code>.
+         *
+         * See LockProfiler for reading the recorded wait and hold times.
+         */
+        US_Framework_EXPORT extern const std::string
+            FRAMEWORK_LOCK_PROFILING; // = "org.cppmicroservices.framework.lock.profiling"
+
         /*
          * Service properties.
          */
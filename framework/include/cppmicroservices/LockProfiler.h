@@ -0,0 +1,122 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#ifndef CPPMICROSERVICES_LOCKPROFILER_H
+#define CPPMICROSERVICES_LOCKPROFILER_H
+
+#include "cppmicroservices/FrameworkExport.h"
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cppmicroservices
+{
+
+    /**
+     * \ingroup MicroServices
+     *
+     * Statistics of one named lock site, e.g. the service registry or the
+     * service listeners, aggregated over all locks of that kind.
+     */
+    struct LockSiteStatistics
+    {
+        std::string name;
+
+        /** Number of times a lock of this site was acquired. */
+        std::uint64_t acquisitions = 0;
+
+        /** Number of acquisitions which had to wait for another thread. */
+        std::uint64_t contentions = 0;
+
+        std::chrono::nanoseconds totalWait { 0 };
+        std::chrono::nanoseconds maxWait { 0 };
+        std::chrono::nanoseconds totalHold { 0 };
+        std::chrono::nanoseconds maxHold { 0 };
+
+        /**
+         * Wait and hold time histograms. Bucket \c i counts durations in
+         * <code>[2^(i-1), 2^i)</code> nanoseconds.
+         */
+        std::vector<std::uint64_t> waitHistogram;
+        std::vector<std::uint64_t> holdHistogram;
+    };
+
+    /**
+     * \ingroup MicroServices
+     *
+     * Process wide profiler of the locks guarding the framework's central
+     * data structures: the service registry, the service listeners, the
+     * service hooks and the bundle registry. Per object locks, e.g. of
+     * bundles and service registrations, and locks of the header only
+     * service and bundle trackers are not profiled.
+     *
+     * While enabled, every lock acquisition records the time spent waiting
+     * for the lock and the time the lock was held. Profiling is enabled
+     * programmatically or by starting a framework with
+     * Constants::FRAMEWORK_LOCK_PROFILING set to \c true. The statistics are
+     * kept when profiling is disabled, until Reset() is called.
+     *
+     * Profiling requires a build with threading support, otherwise no
+     * statistics are recorded.
+     */
+    class US_Framework_EXPORT LockProfiler
+    {
+      public:
+        static bool IsEnabled() noexcept;
+
+        static void Enable();
+
+        /**
+         * Stops recording once every Enable() call has been matched.
+         */
+        static void Disable();
+
+        /**
+         * Returns the statistics of all lock sites which were acquired at
+         * least once, the site with the highest total wait time first.
+         */
+        static std::vector<LockSiteStatistics> GetStatistics();
+
+        /**
+         * Discards all recorded statistics.
+         */
+        static void Reset();
+
+        /**
+         * Writes the statistics as a human readable table, including median
+         * and 99th percentile wait and hold times estimated from the
+         * histograms.
+         */
+        static void WriteReport(std::ostream& out);
+
+        /**
+         * Returns the upper bound of the histogram bucket containing the
+         * given percentile, or zero if the histogram is empty.
+         */
+        static std::chrono::nanoseconds Percentile(std::vector<std::uint64_t> const& histogram, double percentile);
+    };
+} // namespace cppmicroservices
+
+#endif // CPPMICROSERVICES_LOCKPROFILER_H
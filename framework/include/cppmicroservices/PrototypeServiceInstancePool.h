@@ -0,0 +1,64 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#ifndef CPPMICROSERVICES_PROTOTYPESERVICEINSTANCEPOOL_H
+#define CPPMICROSERVICES_PROTOTYPESERVICEINSTANCEPOOL_H
+
+#include <cstddef>
+
+namespace cppmicroservices
+{
+
+    /**
+     * @ingroup MicroServices
+     *
+     * Opts a PrototypeServiceFactory into pooling of released service objects.
+     *
+     * A PrototypeServiceFactory which also derives from this interface lets the
+     * framework keep service objects released by a bundle for reuse. A pooled
+     * service object is not passed to PrototypeServiceFactory::UngetService but
+     * handed out again by the next ServiceObjects::GetService() call of the same
+     * bundle, instead of calling PrototypeServiceFactory::GetService. Only
+     * service objects which do not keep state for a particular caller should be
+     * pooled. Pooled service objects are passed to UngetService when the bundle
+     * stops or the service is unregistered, or if the pool is full.
+     *
+     * @see PrototypeServiceFactory
+     */
+    struct PrototypeServiceInstancePool
+    {
+        virtual ~PrototypeServiceInstancePool() = default;
+
+        /**
+         * Returns how many released service objects the framework may keep per
+         * bundle for reuse.
+         *
+         * The framework calls this method once, when the service is registered.
+         *
+         * @return The maximum number of pooled service objects per bundle. A
+         *         value of 0 disables pooling.
+         */
+        virtual std::size_t GetInstancePoolCapacity() const = 0;
+    };
+} // namespace cppmicroservices
+
+#endif // CPPMICROSERVICES_PROTOTYPESERVICEINSTANCEPOOL_H
@@ -26,6 +26,8 @@
 #include "cppmicroservices/ServiceProperties.h"
 #include "cppmicroservices/ServiceReference.h"
 #include <functional>
+#include <string>
+#include <vector>
 
 namespace cppmicroservices
 {
@@ -132,6 +134,41 @@ namespace cppmicroservices
         void SetProperties(ServiceProperties const& properties);
         void SetProperties(ServiceProperties&& properties);
 
+        /**
+         * Changes some of the properties associated with a service.
+         *
+         * <p>
+         * Unlike SetProperties, the properties not named in <code>changes</code>
+         * or <code>removals</code> are kept, and the service's properties are
+         * updated in place. Keys are matched ignoring case; a changed property
+         * whose key only differs in case from an existing one replaces it.
+         * The Constants#OBJECTCLASS, Constants#SERVICE_ID and
+         * Constants#SERVICE_SCOPE properties cannot be modified and are ignored.
+         *
+         * <p>
+         * The following steps are taken to modify service properties:
+         * <ol>
+         * <li>The properties named in <code>removals</code> are removed.
+         * <li>The properties in <code>changes</code> are added or replaced.
+         * <li>A service event of type ServiceEvent#SERVICE_MODIFIED is fired.
+         *     Only listeners whose filters compare one of the changed keys are
+         *     evaluated against the old properties, to determine whether they
+         *     receive ServiceEvent#SERVICE_MODIFIED_ENDMATCH.
+         * </ol>
+         * If neither <code>changes</code> nor <code>removals</code> name a
+         * modifiable property, nothing happens.
+         *
+         * @param changes The properties to add or replace.
+         * @param removals The keys of the properties to remove.
+         *
+         * @throws std::logic_error If this <code>ServiceRegistrationBase</code>
+         *         object has already been unregistered or if it is invalid.
+         * @throws std::invalid_argument If <code>changes</code> contains
+         *         case variants of the same key name or if the
+         *         Constants#SERVICE_RANKING property is not an int.
+         */
+        void UpdateProperties(ServiceProperties const& changes, std::vector<std::string> const& removals = {});
+
         /**
          * Unregisters a service. Remove a <code>ServiceRegistrationBase</code> object
          * from the framework service registry. All <code>ServiceRegistrationBase</code>
@@ -25,9 +25,91 @@
 
 #include "cppmicroservices/ServiceReference.h"
 
+#include <cstddef>
+#include <memory>
+#include <vector>
+
 namespace cppmicroservices
 {
 
+    namespace detail
+    {
+        /**
+         * The batch callbacks shared by all ServiceTrackerCustomizer specializations.
+         */
+        template <class S, class TrackedParamType>
+        struct ServiceTrackerCustomizerBase
+        {
+            virtual ~ServiceTrackerCustomizerBase() = default;
+
+            virtual std::shared_ptr<TrackedParamType> AddingService(ServiceReference<S> const& reference) = 0;
+            virtual void RemovedService(ServiceReference<S> const& reference,
+                                        std::shared_ptr<TrackedParamType> const& service)
+                = 0;
+
+            /**
+             * Whether the services matching the search parameters when the
+             * <code>ServiceTracker</code> is opened are added with a single
+             * #AddingServices call. The default is <code>false</code>, in which
+             * case #AddingService is called for each of them.
+             */
+            virtual bool
+            AddsInitialServicesInBatch() const
+            {
+                return false;
+            }
+
+            /**
+             * The services matching the search parameters when the <code>ServiceTracker</code>
+             * is opened are being added to the <code>ServiceTracker</code>.
+             * <p>
+             * This method is called once from <code>ServiceTracker::Open</code>, instead of one
+             * #AddingService call per initial service, if #AddsInitialServicesInBatch returns
+             * <code>true</code>. The references are sorted by descending service ranking and
+             * ascending service id.
+             * <p>
+             * The default implementation calls #AddingService for each reference. If a call
+             * throws, #RemovedService is called for the services added before and the
+             * exception is rethrown.
+             * <p>
+             * If an override returns a vector whose size differs from the number of
+             * references, #RemovedService is called for each returned service object which
+             * has a reference at the same index, and <code>ServiceTracker::Open</code>
+             * throws <code>std::logic_error</code>.
+             *
+             * @param references The references to the services being added to the
+             *        <code>ServiceTracker</code>.
+             * @return The service object to be tracked, or <code>nullptr</code>, for each
+             *         reference in the same order.
+             */
+            virtual std::vector<std::shared_ptr<TrackedParamType>>
+            AddingServices(std::vector<ServiceReference<S>> const& references)
+            {
+                std::vector<std::shared_ptr<TrackedParamType>> services;
+                services.reserve(references.size());
+                try
+                {
+                    for (auto const& reference : references)
+                    {
+                        services.push_back(AddingService(reference));
+                    }
+                }
+                catch (...)
+                {
+                    for (std::size_t i = 0; i < services.size(); ++i)
+                    {
+                        if (services[i])
+                        {
+                            RemovedService(references[i], services[i]);
+                        }
+                    }
+                    throw;
+                }
+                return services;
+            }
+        };
+    } // namespace detail
+
     /**
      * \ingroup MicroServices
      * \ingroup gr_servicetracker
@@ -59,7 +141,7 @@ namespace cppmicroservices
      * \remarks <code>ServiceTrackerCustomizer</code> implementations must also be thread-safe.
      */
     template <class S, class T = S>
-    struct ServiceTrackerCustomizer
+    struct ServiceTrackerCustomizer : detail::ServiceTrackerCustomizerBase<S, T>
     {
 
         struct TypeTraits
@@ -130,7 +212,7 @@ namespace cppmicroservices
     };
 
     template <class S>
-    struct ServiceTrackerCustomizer<S, S>
+    struct ServiceTrackerCustomizer<S, S> : detail::ServiceTrackerCustomizerBase<S, S>
     {
 
         struct TypeTraits
@@ -160,7 +242,7 @@ namespace cppmicroservices
     };
 
     template <class T>
-    struct ServiceTrackerCustomizer<void, T>
+    struct ServiceTrackerCustomizer<void, T> : detail::ServiceTrackerCustomizerBase<void, T>
     {
 
         struct TypeTraits
@@ -191,7 +273,7 @@ namespace cppmicroservices
     };
 
     template <>
-    struct ServiceTrackerCustomizer<void, void>
+    struct ServiceTrackerCustomizer<void, void> : detail::ServiceTrackerCustomizerBase<void, InterfaceMap const>
     {
 
         struct TypeTraits
@@ -28,7 +28,11 @@
 #include "cppmicroservices/detail/WaitCondition.h"
 
 #include <atomic>
+#include <memory>
 #include <optional>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace cppmicroservices
@@ -90,6 +94,13 @@ namespace cppmicroservices
              */
             void TrackInitial();
 
+            /**
+             * Track the initial list of items with a single call to
+             * CustomizerBatch, in the order they were set. This is an
+             * alternative to TrackInitial with the same preconditions.
+             */
+            void TrackInitialBatch();
+
             /**
              * Called by the owning Tracker object when it is closed.
              */
@@ -111,6 +122,18 @@ namespace cppmicroservices
              */
             void Untrack(S item, R related);
 
+            /**
+             * Track and untrack a batch of items with a single call to
+             * CustomizerBatch.
+             *
+             * Every item must appear at most once in \c track and \c untrack
+             * together.
+             *
+             * @param track Items to be tracked, with their action related objects.
+             * @param untrack Items to be untracked, with their action related objects.
+             */
+            void TrackBatch(std::vector<std::pair<S, R>> const& track, std::vector<std::pair<S, R>> const& untrack);
+
             /**
              * Returns the number of tracked items.
              *
@@ -178,6 +201,16 @@ namespace cppmicroservices
              */
             void CopyEntries_unlocked(TrackingMap& map) const;
 
+            /**
+             * Return an immutable copy of the tracked items and associated values.
+             *
+             * The copy is made at most once per modification and shared by all
+             * callers, so that repeated reads do not copy the map under the lock.
+             *
+             * @return The tracked items and associated values.
+             */
+            std::shared_ptr<TrackingMap const> GetSnapshot() const;
+
             /**
              * Call the specific customizer adding method. This method must not be
              * called while synchronized on this object.
@@ -209,6 +242,23 @@ namespace cppmicroservices
              */
             virtual void CustomizerRemoved(S item, R const& related, T const& object) = 0;
 
+            /**
+             * Call the customizer for a batch of changes. This method must not
+             * be called while synchronized on this object.
+             *
+             * The default implementation calls CustomizerRemoved, CustomizerModified
+             * and CustomizerAdding for each item.
+             *
+             * @param adding Items to be tracked.
+             * @param modified Tracked items with their customized objects.
+             * @param removed Untracked items with their customized objects.
+             * @return The customized object, or <code>std::nullopt</code>, for
+             *         each entry of \c adding in the same order.
+             */
+            virtual std::vector<std::optional<T>> CustomizerBatch(std::vector<std::pair<S, R>> const& adding,
+                                                                  std::vector<std::tuple<S, R, T>> const& modified,
+                                                                  std::vector<std::tuple<S, R, T>> const& removed);
+
             /**
              * List of items in the process of being added. This is used to deal with
              * nesting of events. Since events may be synchronously delivered, events
@@ -217,13 +267,13 @@ namespace cppmicroservices
              * nested call to untrack that the service was unregistered can be made to
              * the track method.
              *
-             * Since the std::vector implementation is not synchronized, all access to
-             * this list must be protected by the same synchronized object for
-             * thread-safety.
+             * Since the std::unordered_set implementation is not synchronized, all
+             * access to this set must be protected by the same synchronized object
+             * for thread-safety.
              *
              * @GuardedBy this
              */
-            std::list<S> adding;
+            std::unordered_set<S> adding;
 
             /**
              * true if the tracked object is closed.
@@ -259,6 +309,21 @@ namespace cppmicroservices
              */
             void TrackAdding(S item, R related);
 
+            /**
+             * Common logic to add, modify and remove a batch of items used by
+             * TrackBatch and TrackInitialBatch. The items in \c addingItems
+             * must have been placed in the adding list, and the items in
+             * \c removedItems removed from the tracked map, before calling
+             * this method.
+             *
+             * @param addingItems Items to be tracked.
+             * @param modifiedItems Tracked items with their customized objects.
+             * @param removedItems Untracked items with their customized objects.
+             */
+            void TrackAddingBatch(std::vector<std::pair<S, R>> const& addingItems,
+                                  std::vector<std::tuple<S, R, T>> const& modifiedItems,
+                                  std::vector<std::tuple<S, R, T>> const& removedItems);
+
           private:
             using Self = BundleAbstractTracked<S, T, R>;
 
@@ -275,9 +340,16 @@ namespace cppmicroservices
              */
             std::atomic<int> trackingCount;
 
+            /**
+             * Cached copy of the tracked map, cleared by Modified.
+             */
+            mutable Atomic<std::shared_ptr<TrackingMap const>> snapshot;
+
             BundleContext bc;
 
             bool CustomizerAddingFinal(S item, std::optional<T> const& custom);
+
+            bool CustomizerAddingFinal_unlocked(S item, std::optional<T> const& custom);
         };
 
     } // namespace detail
@@ -24,6 +24,7 @@
 #include "cppmicroservices/detail/Log.h"
 
 #include <iterator>
+#include <stdexcept>
 
 namespace cppmicroservices
 {
@@ -77,14 +78,14 @@ namespace cppmicroservices
                         /* if we are already tracking this item */
                         continue; /* skip this item */
                     }
-                    if (std::find(adding.begin(), adding.end(), item) != adding.end())
+                    if (adding.count(item) != 0)
                     {
                         /*
                          * if this item is already in the process of being added.
                          */
                         continue; /* skip this item */
                     }
-                    adding.push_back(item);
+                    adding.insert(item);
                 }
                 TrackAdding(item, R());
                 /*
@@ -95,6 +96,36 @@ namespace cppmicroservices
             }
         }
 
+        template <class S, class T, class R>
+        void
+        BundleAbstractTracked<S, T, R>::TrackInitialBatch()
+        {
+            std::vector<std::pair<S, R>> addingItems;
+            {
+                auto l = this->Lock();
+                US_UNUSED(l);
+                if (closed)
+                {
+                    return;
+                }
+                /*
+                 * move all initial items to the adding list within one
+                 * synchronized block, skipping items which are already tracked
+                 * or in the process of being added.
+                 */
+                addingItems.reserve(initial.size());
+                for (auto& item : initial)
+                {
+                    if (tracked.find(item) == tracked.end() && adding.insert(item).second)
+                    {
+                        addingItems.emplace_back(std::move(item), R());
+                    }
+                }
+                initial.clear();
+            }
+            TrackAddingBatch(addingItems, {}, {});
+        }
+
         template <class S, class T, class R>
         void
         BundleAbstractTracked<S, T, R>::Close()
@@ -123,12 +154,12 @@ namespace cppmicroservices
                 }
                 if (!isInMap)
                 { /* we are not tracking the item */
-                    if (std::find(adding.begin(), adding.end(), item) != adding.end())
+                    if (adding.count(item) != 0)
                     {
                         /* if this item is already in the process of being added. */
                         return;
                     }
-                    adding.push_back(item); /* mark this item is being added */
+                    adding.insert(item); /* mark this item is being added */
                 }
                 else
                 {               /* we are currently tracking this item */
@@ -170,9 +201,7 @@ namespace cppmicroservices
                              */
                 }
 
-                std::size_t addingSize = adding.size();
-                adding.remove(item);
-                if (addingSize != adding.size())
+                if (adding.erase(item) != 0)
                 {           /* if the item is in the process of
                              * being added
                              */
@@ -203,6 +232,151 @@ namespace cppmicroservices
              */
         }
 
+        template <class S, class T, class R>
+        void
+        BundleAbstractTracked<S, T, R>::TrackBatch(std::vector<std::pair<S, R>> const& track,
+                                                   std::vector<std::pair<S, R>> const& untrack)
+        {
+            std::vector<std::pair<S, R>> addingItems;
+            std::vector<std::tuple<S, R, T>> modifiedItems;
+            std::vector<std::tuple<S, R, T>> removedItems;
+            {
+                auto l = this->Lock();
+                US_UNUSED(l);
+                if (closed)
+                {
+                    return;
+                }
+                /* same bookkeeping as Untrack, for the whole batch */
+                for (auto const& [item, related] : untrack)
+                {
+                    std::size_t initialSize = initial.size();
+                    initial.remove(item);
+                    if (initialSize != initial.size() || adding.erase(item) != 0)
+                    {
+                        continue;
+                    }
+                    auto trackedItemIter = tracked.find(item);
+                    if (trackedItemIter == tracked.end())
+                    {
+                        continue;
+                    }
+                    removedItems.emplace_back(item, related, trackedItemIter->second);
+                    tracked.erase(trackedItemIter);
+                    Modified(); /* increment modification count */
+                }
+                /* same bookkeeping as Track, for the whole batch */
+                for (auto const& [item, related] : track)
+                {
+                    auto trackedItemIter = tracked.find(item);
+                    if (trackedItemIter != tracked.end())
+                    {
+                        modifiedItems.emplace_back(item, related, trackedItemIter->second);
+                        Modified(); /* increment modification count */
+                        continue;
+                    }
+                    if (adding.insert(item).second)
+                    {
+                        addingItems.emplace_back(item, related);
+                    }
+                }
+            }
+
+            TrackAddingBatch(addingItems, modifiedItems, removedItems);
+        }
+
+        template <class S, class T, class R>
+        void
+        BundleAbstractTracked<S, T, R>::TrackAddingBatch(std::vector<std::pair<S, R>> const& addingItems,
+                                                         std::vector<std::tuple<S, R, T>> const& modifiedItems,
+                                                         std::vector<std::tuple<S, R, T>> const& removedItems)
+        {
+            if (addingItems.empty() && modifiedItems.empty() && removedItems.empty())
+            {
+                return;
+            }
+
+            std::vector<std::optional<T>> objects;
+            /* Call customizer outside of synchronized region */
+            try
+            {
+                objects = CustomizerBatch(addingItems, modifiedItems, removedItems);
+                if (objects.size() != addingItems.size())
+                {
+                    throw std::logic_error("The batch customizer must return one object per added item");
+                }
+            }
+            catch (...)
+            {
+                /*
+                 * If the customizer throws an exception, it will
+                 * propagate after none of the added items was tracked.
+                 */
+                {
+                    auto l = this->Lock();
+                    US_UNUSED(l);
+                    for (auto const& addingItem : addingItems)
+                    {
+                        adding.erase(addingItem.first);
+                    }
+                }
+                /* Release the objects the customizer returned, if any */
+                for (std::size_t i = 0; i < objects.size() && i < addingItems.size(); ++i)
+                {
+                    if (objects[i])
+                    {
+                        CustomizerRemoved(addingItems[i].first, addingItems[i].second, objects[i].value());
+                    }
+                }
+                throw;
+            }
+
+            std::vector<std::size_t> becameUntracked;
+            {
+                auto l = this->Lock();
+                US_UNUSED(l);
+                for (std::size_t i = 0; i < addingItems.size(); ++i)
+                {
+                    if (CustomizerAddingFinal_unlocked(addingItems[i].first, objects[i]) && objects[i])
+                    {
+                        becameUntracked.push_back(i);
+                    }
+                }
+            }
+
+            /*
+             * The items became untracked during the customizer callback.
+             */
+            for (auto i : becameUntracked)
+            {
+                /* Call customizer outside of synchronized region */
+                CustomizerRemoved(addingItems[i].first, addingItems[i].second, objects[i].value());
+            }
+        }
+
+        template <class S, class T, class R>
+        std::vector<std::optional<T>>
+        BundleAbstractTracked<S, T, R>::CustomizerBatch(std::vector<std::pair<S, R>> const& addingItems,
+                                                        std::vector<std::tuple<S, R, T>> const& modifiedItems,
+                                                        std::vector<std::tuple<S, R, T>> const& removedItems)
+        {
+            for (auto const& [item, related, object] : removedItems)
+            {
+                CustomizerRemoved(item, related, object);
+            }
+            for (auto const& [item, related, object] : modifiedItems)
+            {
+                CustomizerModified(item, related, object);
+            }
+            std::vector<std::optional<T>> objects;
+            objects.reserve(addingItems.size());
+            for (auto const& [item, related] : addingItems)
+            {
+                objects.push_back(CustomizerAdding(item, related));
+            }
+            return objects;
+        }
+
         template <class S, class T, class R>
         std::size_t
         BundleAbstractTracked<S, T, R>::Size_unlocked() const
@@ -246,6 +420,7 @@ namespace cppmicroservices
         {
             // atomic
             ++trackingCount;
+            snapshot.Store(nullptr); /* clear cached value */
         }
 
         template <class S, class T, class R>
@@ -263,15 +438,40 @@ namespace cppmicroservices
             map.insert(tracked.begin(), tracked.end());
         }
 
+        template <class S, class T, class R>
+        std::shared_ptr<typename BundleAbstractTracked<S, T, R>::TrackingMap const>
+        BundleAbstractTracked<S, T, R>::GetSnapshot() const
+        {
+            auto cached = snapshot.Load();
+            if (cached)
+            {
+                return cached;
+            }
+            auto l = this->Lock();
+            US_UNUSED(l);
+            cached = snapshot.Load();
+            if (!cached)
+            {
+                cached = std::make_shared<TrackingMap const>(tracked);
+                snapshot.Store(cached);
+            }
+            return cached;
+        }
+
         template <class S, class T, class R>
         bool
         BundleAbstractTracked<S, T, R>::CustomizerAddingFinal(S item, std::optional<T> const& custom)
         {
             auto l = this->Lock();
             US_UNUSED(l);
-            std::size_t addingSize = adding.size();
-            adding.remove(item);
-            if (addingSize != adding.size() && !closed)
+            return CustomizerAddingFinal_unlocked(item, custom);
+        }
+
+        template <class S, class T, class R>
+        bool
+        BundleAbstractTracked<S, T, R>::CustomizerAddingFinal_unlocked(S item, std::optional<T> const& custom)
+        {
+            if (adding.erase(item) != 0 && !closed)
             {
                 /*
                  * if the item was not untracked during the customizer
@@ -31,6 +31,8 @@
 namespace cppmicroservices
 {
 
+    class BundleResourceReader;
+
     namespace detail
     {
 
@@ -47,6 +49,13 @@ namespace cppmicroservices
                                           std::size_t size,
                                           std::ios_base::openmode mode);
 
+            /**
+             * Reads the resource through \c reader. Large resources opened in
+             * binary mode are read incrementally through a fixed-size window;
+             * all others are extracted completely up front.
+             */
+            explicit BundleResourceBuffer(std::unique_ptr<BundleResourceReader> reader, std::ios_base::openmode mode);
+
             ~BundleResourceBuffer() override;
 
           private:
@@ -64,6 +73,8 @@ namespace cppmicroservices
             pos_type seekpos(pos_type sp,
                              std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
 
+            void Init(std::unique_ptr<void, void (*)(void*)> data, std::size_t size, std::ios_base::openmode mode);
+
           private:
             std::unique_ptr<BundleResourceBufferPrivate> d;
         };
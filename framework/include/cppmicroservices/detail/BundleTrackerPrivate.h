@@ -29,6 +29,7 @@
 #include "cppmicroservices/detail/Threads.h"
 #include "cppmicroservices/detail/TrackedBundle.h"
 
+#include <atomic>
 #include <memory>
 #include <stdexcept>
 #include <utility>
@@ -61,6 +62,7 @@ namespace cppmicroservices
                 , _customizer(customizer)
                 , listenerToken()
                 , trackedBundle()
+                , batchDepth(0)
                 , _bundleTracker(bundleTracker)
             {
             }
@@ -90,13 +92,14 @@ namespace cppmicroservices
             }
 
             void
-            GetBundles_unlocked(std::vector<Bundle>& refs, TrackedBundle<T>* t) const
+            GetBundles(std::vector<Bundle>& refs, TrackedBundle<T>* t) const
             {
-                if (t->Size_unlocked() == 0)
+                auto snapshot = t->GetSnapshot();
+                refs.reserve(snapshot->size());
+                for (auto const& entry : *snapshot)
                 {
-                    return;
+                    refs.push_back(entry.first);
                 }
-                t->GetTracked_unlocked(refs);
             }
 
             /**
@@ -125,6 +128,12 @@ namespace cppmicroservices
              */
             Atomic<std::shared_ptr<TrackedBundle<T>>> trackedBundle;
 
+            /**
+             * Number of BeginBatch calls not yet matched by EndBatch. Bundle events
+             * are queued instead of delivered while this is greater than zero.
+             */
+            std::atomic<int> batchDepth;
+
             /**
              * Accessor method for the current TrackedBundle object. This method is only
              * intended to be used by the unsynchronized methods which do not modify the
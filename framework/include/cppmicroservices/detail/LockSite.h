@@ -0,0 +1,150 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#ifndef CPPMICROSERVICES_DETAIL_LOCKSITE_H
+#define CPPMICROSERVICES_DETAIL_LOCKSITE_H
+
+#include "cppmicroservices/FrameworkExport.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace cppmicroservices
+{
+
+    class LockProfiler;
+
+    namespace detail
+    {
+
+        /**
+         * Lock statistics shared by all locks of one kind, e.g. all service
+         * registry locks. A MutexLockingStrategy assigned to a site records
+         * into it while LockProfiler is enabled.
+         *
+         * Sites are registered with the LockProfiler for their lifetime and
+         * are meant to be objects with static storage duration inside the
+         * framework library. Sites with the same name are reported together.
+         *
+         * The assignment of mutexes to sites is kept in a table inside the
+         * framework, keyed by mutex address, so that the layout of
+         * MutexLockingStrategy and its UniqueLock does not depend on
+         * profiling. Lock operations only consult it while profiling is
+         * enabled.
+         */
+        class US_Framework_EXPORT LockSite
+        {
+          public:
+            using Clock = std::chrono::steady_clock;
+
+            /**
+             * Number of histogram buckets. Bucket \c i counts durations in
+             * <code>[2^(i-1), 2^i)</code> nanoseconds, the last bucket also
+             * counts all longer durations.
+             */
+            static constexpr std::size_t HistogramSize = 40;
+
+            using Histogram = std::array<std::atomic<std::uint64_t>, HistogramSize>;
+
+            /**
+             * \c name must be a string literal.
+             */
+            explicit LockSite(char const* name);
+            ~LockSite();
+
+            LockSite(LockSite const&) = delete;
+            LockSite& operator=(LockSite const&) = delete;
+
+            char const*
+            GetName() const noexcept
+            {
+                return name;
+            }
+
+            bool
+            IsEnabled() const noexcept
+            {
+                return IsProfiling();
+            }
+
+            /**
+             * Whether the LockProfiler is enabled. Checked on every lock
+             * acquisition before any other profiling work is done.
+             */
+            static bool
+            IsProfiling() noexcept
+            {
+                return profiling.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * Assigns the locks of \c mutex to \c site, or removes the
+             * assignment if \c site is \c nullptr.
+             */
+            static void Assign(void const* mutex, LockSite* site);
+
+            /**
+             * Called by the holder of \c mutex after acquiring it while
+             * profiling is enabled.
+             */
+            static void Acquired(void const* mutex, Clock::duration wait, bool contended) noexcept;
+
+            /**
+             * Called by the holder of \c mutex before releasing it while
+             * profiling is enabled.
+             */
+            static void Released(void const* mutex) noexcept;
+
+            /**
+             * Called by the holder of \c mutex after a condition variable
+             * wait acquired it again while profiling is enabled.
+             */
+            static void Reacquired(void const* mutex) noexcept;
+
+            void RecordAcquisition(Clock::duration wait, bool contended) noexcept;
+            void RecordHold(Clock::duration hold) noexcept;
+
+            void Reset() noexcept;
+
+            std::atomic<std::uint64_t> acquisitions;
+            std::atomic<std::uint64_t> contentions;
+            std::atomic<std::uint64_t> totalWaitNs;
+            std::atomic<std::uint64_t> maxWaitNs;
+            std::atomic<std::uint64_t> totalHoldNs;
+            std::atomic<std::uint64_t> maxHoldNs;
+            Histogram waitHistogram;
+            Histogram holdHistogram;
+
+          private:
+            friend class cppmicroservices::LockProfiler;
+
+            static std::atomic<bool> profiling;
+
+            char const* const name;
+        };
+
+    } // namespace detail
+} // namespace cppmicroservices
+
+#endif // CPPMICROSERVICES_DETAIL_LOCKSITE_H
@@ -132,6 +132,10 @@ namespace cppmicroservices
                                                                                          : d->listenerFilter);
                     }
                 }
+                if (d->customizer->AddsInitialServicesInBatch())
+                {
+                    d->SortInitialReferences(references);
+                }
                 /* set tracked with the initial references */
                 t->SetInitial(references);
             }
@@ -143,7 +147,14 @@ namespace cppmicroservices
             d->trackedService.Store(t);
         }
         /* Call tracked outside of synchronized region */
-        t->TrackInitial(); /* process the initial references */
+        if (d->customizer->AddsInitialServicesInBatch())
+        {
+            t->TrackInitialBatch(); /* process the initial references */
+        }
+        else
+        {
+            t->TrackInitial(); /* process the initial references */
+        }
     }
 
     template <class S, class T>
@@ -77,6 +77,12 @@ namespace cppmicroservices
             std::vector<ServiceReference<S>> GetInitialReferences(std::string const& className,
                                                                   std::string const& filterString);
 
+            /**
+             * Sorts references by descending service ranking and ascending
+             * service id, for a customizer adding the initial services in a batch.
+             */
+            static void SortInitialReferences(std::vector<ServiceReference<S>>& references);
+
             void GetServiceReferences_unlocked(std::vector<ServiceReference<S>>& refs, TrackedService<S, TTT>* t) const;
 
             /**
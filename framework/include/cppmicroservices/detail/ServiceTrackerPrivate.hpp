@@ -26,8 +26,10 @@
 #include "cppmicroservices/Constants.h"
 #include "cppmicroservices/LDAPFilter.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace cppmicroservices
 {
@@ -145,6 +147,44 @@ namespace cppmicroservices
             return result;
         }
 
+        template <class S, class TTT>
+        void
+        ServiceTrackerPrivate<S, TTT>::SortInitialReferences(std::vector<ServiceReference<S>>& references)
+        {
+            /*
+             * The keys are read once per reference, since comparing references
+             * directly locks the properties of both references for every
+             * comparison.
+             */
+            using RankedReference = std::pair<std::pair<int, long int>, ServiceReference<S>>;
+            std::vector<RankedReference> ranked;
+            ranked.reserve(references.size());
+            for (auto& ref : references)
+            {
+                Any rankingAny = ref.GetProperty(Constants::SERVICE_RANKING);
+                Any idAny = ref.GetProperty(Constants::SERVICE_ID);
+                int ranking = rankingAny.Type() == typeid(int) ? any_cast<int>(rankingAny) : 0;
+                long int id = idAny.Type() == typeid(long int) ? any_cast<long int>(idAny) : 0;
+                ranked.emplace_back(std::make_pair(ranking, id), std::move(ref));
+            }
+            std::sort(ranked.begin(),
+                      ranked.end(),
+                      [](RankedReference const& a, RankedReference const& b)
+                      {
+                          if (a.first.first != b.first.first)
+                          {
+                              return a.first.first > b.first.first;
+                          }
+                          return a.first.second < b.first.second;
+                      });
+
+            references.clear();
+            for (auto& rankedReference : ranked)
+            {
+                references.push_back(std::move(rankedReference.second));
+            }
+        }
+
         template <class S, class TTT>
         void
         ServiceTrackerPrivate<S, TTT>::GetServiceReferences_unlocked(std::vector<ServiceReference<S>>& refs,
@@ -24,6 +24,7 @@
 #define CPPMICROSERVICES_THREADS_H
 
 #include "cppmicroservices/FrameworkConfig.h"
+#include "cppmicroservices/detail/LockSite.h"
 
 #include <atomic>
 #include <memory>
@@ -53,6 +54,25 @@ namespace cppmicroservices
             {
             }
 
+            /**
+             * @brief Assign the lock statistics site of this object.
+             *
+             * Locks of this object are recorded into \c site while the
+             * LockProfiler is enabled. The assignment is kept by the
+             * framework, keyed by the address of this object's mutex, and
+             * must be removed by assigning \c nullptr before this object is
+             * destroyed. Only used by framework internal classes.
+             */
+            void
+            SetLockSite(LockSite* site) const
+            {
+#ifdef US_ENABLE_THREADING_SUPPORT
+                LockSite::Assign(&m_Mtx, site);
+#else
+                US_UNUSED(site);
+#endif
+            }
+
             friend class UniqueLock;
 
             class UniqueLock
@@ -70,27 +90,49 @@ namespace cppmicroservices
                 UniqueLock&
                 operator=(UniqueLock&& o) noexcept
                 {
+                    EndHold();
                     m_Lock = std::move(o.m_Lock);
                     return *this;
                 }
 
                 // Lock object
-                explicit UniqueLock(MutexLockingStrategy const& host) : m_Lock(host.m_Mtx) {}
+                explicit UniqueLock(MutexLockingStrategy const& host) : m_Lock(host.m_Mtx, std::defer_lock)
+                {
+                    Lock();
+                }
 
                 // Lock object
-                explicit UniqueLock(MutexLockingStrategy const* host) : m_Lock(host->m_Mtx) {}
+                explicit UniqueLock(MutexLockingStrategy const* host) : m_Lock(host->m_Mtx, std::defer_lock)
+                {
+                    Lock();
+                }
 
                 UniqueLock(MutexLockingStrategy const& host, std::defer_lock_t d) : m_Lock(host.m_Mtx, d) {}
 
+                ~UniqueLock() { EndHold(); }
+
                 void
                 Lock()
                 {
-                    m_Lock.lock();
+                    if (!LockSite::IsProfiling())
+                    {
+                        m_Lock.lock();
+                        return;
+                    }
+
+                    auto const start = LockSite::Clock::now();
+                    bool const contended = !m_Lock.try_lock();
+                    if (contended)
+                    {
+                        m_Lock.lock();
+                    }
+                    LockSite::Acquired(m_Lock.mutex(), LockSite::Clock::now() - start, contended);
                 }
 
                 void
                 UnLock()
                 {
+                    EndHold();
                     m_Lock.unlock();
                 }
 
@@ -130,7 +172,40 @@ namespace cppmicroservices
                 friend class WaitCondition<MutexLockingStrategy>;
 
 #ifdef US_ENABLE_THREADING_SUPPORT
+                /**
+                 * Records the time the lock was held so far, if its
+                 * acquisition was profiled. Also used by WaitCondition
+                 * around waits, which release the lock.
+                 */
+                void
+                EndHold() noexcept
+                {
+                    if (m_Lock.owns_lock() && LockSite::IsProfiling())
+                    {
+                        LockSite::Released(m_Lock.mutex());
+                    }
+                }
+
+                void
+                BeginHold() noexcept
+                {
+                    if (LockSite::IsProfiling())
+                    {
+                        LockSite::Reacquired(m_Lock.mutex());
+                    }
+                }
+
                 std::unique_lock<MutexType> m_Lock;
+#else
+                void
+                EndHold() noexcept
+                {
+                }
+
+                void
+                BeginHold() noexcept
+                {
+                }
 #endif
             };
 
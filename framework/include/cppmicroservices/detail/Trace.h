@@ -0,0 +1,124 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+  =============================================================================*/
+
+#ifndef CPPMICROSERVICES_DETAIL_TRACE_H
+#define CPPMICROSERVICES_DETAIL_TRACE_H
+
+#include "cppmicroservices/FrameworkExport.h"
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace cppmicroservices
+{
+
+    namespace detail
+    {
+
+        /**
+         * Process wide recorder of timed spans, used to profile framework,
+         * Declarative Services and Configuration Admin startup.
+         *
+         * Recording is enabled while at least one framework was started with
+         * Constants::FRAMEWORK_TRACE_FILE set. Each thread appends to its own
+         * buffer, so recording spans does not contend with other threads.
+         * A buffer holds at most MAX_SPANS_PER_THREAD spans. Later spans of
+         * that thread are dropped and only counted, which keeps the startup
+         * spans and bounds the memory used by long running frameworks.
+         */
+        class US_Framework_EXPORT Tracer
+        {
+          public:
+            using Clock = std::chrono::steady_clock;
+
+            static constexpr std::size_t MAX_SPANS_PER_THREAD = 64 * 1024;
+
+            static bool IsEnabled() noexcept;
+
+            static void Enable();
+
+            /**
+             * Stops recording once every Enable() call has been matched. The
+             * recorded spans are discarded when recording stops.
+             */
+            static void Disable();
+
+            static void Record(char const* category,
+                               char const* name,
+                               std::string const& detail,
+                               Clock::time_point begin,
+                               Clock::time_point end) noexcept;
+
+            /**
+             * Writes all spans recorded so far as a Chrome trace event JSON
+             * object, which can be loaded into chrome://tracing or Perfetto.
+             * The number of dropped spans is written as "droppedSpans" in the
+             * "otherData" member.
+             */
+            static void WriteChromeTrace(std::ostream& out);
+        };
+
+        /**
+         * Records the lifetime of the object as a span, if tracing is enabled.
+         * \c category and \c name must be string literals. \c detail is only
+         * copied when tracing is enabled.
+         */
+        class TraceSpan
+        {
+          public:
+            TraceSpan(char const* category, char const* name, std::string const& detail = std::string())
+                : enabled(Tracer::IsEnabled())
+                , category(category)
+                , name(name)
+            {
+                if (enabled)
+                {
+                    this->detail = detail;
+                    begin = Tracer::Clock::now();
+                }
+            }
+
+            TraceSpan(TraceSpan const&) = delete;
+            TraceSpan& operator=(TraceSpan const&) = delete;
+
+            ~TraceSpan()
+            {
+                if (enabled)
+                {
+                    Tracer::Record(category, name, detail, begin, Tracer::Clock::now());
+                }
+            }
+
+          private:
+            bool const enabled;
+            char const* const category;
+            char const* const name;
+            std::string detail;
+            Tracer::Clock::time_point begin;
+        };
+
+    } // namespace detail
+} // namespace cppmicroservices
+
+#endif // CPPMICROSERVICES_DETAIL_TRACE_H
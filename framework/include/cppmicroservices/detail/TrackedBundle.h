@@ -30,6 +30,10 @@
 #include "cppmicroservices/detail/CounterLatch.h"
 #include "cppmicroservices/detail/ScopeGuard.h"
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace cppmicroservices {
 
 template<class T>
@@ -100,6 +104,18 @@ public:
       if (this->closed) {
         return;
       }
+
+      // Keep only the last event per bundle until the batch is flushed
+      if (_bundleTracker->d->batchDepth > 0) {
+        auto pendingIter = pendingIndex.find(bundle);
+        if (pendingIter == pendingIndex.end()) {
+          pendingIndex.emplace(bundle, pendingEvents.size());
+          pendingEvents.push_back(event);
+        } else {
+          pendingEvents[pendingIter->second] = event;
+        }
+        return;
+      }
     }
 
     // Track iff state in mask
@@ -118,6 +134,48 @@ public:
     }
   }
 
+  /**
+   * Track or untrack all bundles with events queued while batching,
+   * according to their current state, using a single customizer call.
+   */
+  void FlushBatch()
+  {
+    (void)latch.CountUp();
+    ScopeGuard sg([this]() {
+      try {
+        latch.CountDown();
+      } catch (...) {
+      }
+    });
+
+    std::vector<BundleEvent> events;
+    {
+      auto l = this->Lock();
+      US_UNUSED(l);
+      events.swap(pendingEvents);
+      pendingIndex.clear();
+      if (this->closed) {
+        return;
+      }
+    }
+
+    std::vector<std::pair<Bundle, BundleEvent>> track;
+    std::vector<std::pair<Bundle, BundleEvent>> untrack;
+    for (auto& event : events) {
+      Bundle bundle = event.GetBundle();
+      Bundle::State state = bundle.GetState();
+      if (!state) {
+        continue;
+      }
+      if (state & _bundleTracker->d->_stateMask) {
+        track.emplace_back(std::move(bundle), std::move(event));
+      } else {
+        untrack.emplace_back(std::move(bundle), std::move(event));
+      }
+    }
+    this->TrackBatch(track, untrack);
+  }
+
   void WaitOnCustomizersToFinish() { latch.Wait(); }
 
 private:
@@ -126,6 +184,21 @@ private:
 
   CounterLatch latch;
 
+  /**
+   * Last event of each bundle received while batching, in the order
+   * the bundles were first seen.
+   *
+   * @GuardedBy this
+   */
+  std::vector<BundleEvent> pendingEvents;
+
+  /**
+   * Position of each bundle in pendingEvents.
+   *
+   * @GuardedBy this
+   */
+  std::unordered_map<Bundle, std::size_t> pendingIndex;
+
   /**
    * Increment the tracking count and tell the tracker there was a
    * modification.
@@ -189,6 +262,33 @@ private:
   {
     _customizer->RemovedBundle(bundle, related, object);
   }
+
+  /**
+   * Call the customizer batch method. This method must not be
+   * called while synchronized on this object.
+   *
+   * @see BundleTrackerCustomizer::BundlesChanged(BundleTrackerChanges<T>)
+   */
+  std::vector<std::optional<T>> CustomizerBatch(
+    const std::vector<std::pair<Bundle, BundleEvent>>& adding,
+    const std::vector<std::tuple<Bundle, BundleEvent, T>>& modified,
+    const std::vector<std::tuple<Bundle, BundleEvent, T>>& removed) override
+  {
+    BundleTrackerChanges<T> changes;
+    changes.adding.reserve(adding.size());
+    for (const auto& item : adding) {
+      changes.adding.push_back(item.second);
+    }
+    changes.modified.reserve(modified.size());
+    for (const auto& item : modified) {
+      changes.modified.emplace_back(std::get<1>(item), std::get<2>(item));
+    }
+    changes.removed.reserve(removed.size());
+    for (const auto& item : removed) {
+      changes.removed.emplace_back(std::get<1>(item), std::get<2>(item));
+    }
+    return _customizer->BundlesChanged(changes);
+  }
 };
 
 } // namespace detail
@@ -31,6 +31,10 @@
 #include "cppmicroservices/detail/ScopeGuard.h"
 
 #include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace cppmicroservices
 {
@@ -120,6 +124,23 @@ namespace cppmicroservices
             void CustomizerRemoved(ServiceReference<S> item,
                                    ServiceEvent const& related,
                                    std::shared_ptr<TrackedParamType> const& object) override;
+
+            /**
+             * Call the customizer for a batch of changes, adding all items with a
+             * single call to the customizer's AddingServices method. This method
+             * must not be called while synchronized on this object.
+             *
+             * @param adding Items to be tracked.
+             * @param modified Tracked items with their customized objects.
+             * @param removed Untracked items with their customized objects.
+             * @return The customized object for each item in \c adding.
+             */
+            std::vector<std::optional<std::shared_ptr<TrackedParamType>>> CustomizerBatch(
+                std::vector<std::pair<ServiceReference<S>, ServiceEvent>> const& adding,
+                std::vector<std::tuple<ServiceReference<S>, ServiceEvent, std::shared_ptr<TrackedParamType>>> const&
+                    modified,
+                std::vector<std::tuple<ServiceReference<S>, ServiceEvent, std::shared_ptr<TrackedParamType>>> const&
+                    removed) override;
         };
 
     } // namespace detail
@@ -166,6 +166,57 @@ namespace cppmicroservices
             customizer->RemovedService(item, object);
         }
 
+        template <class S, class TTT>
+        std::vector<std::optional<std::shared_ptr<typename TrackedService<S, TTT>::TrackedParamType>>>
+        TrackedService<S, TTT>::CustomizerBatch(
+            std::vector<std::pair<ServiceReference<S>, ServiceEvent>> const& adding,
+            std::vector<std::tuple<ServiceReference<S>, ServiceEvent, std::shared_ptr<TrackedParamType>>> const&
+                modified,
+            std::vector<std::tuple<ServiceReference<S>, ServiceEvent, std::shared_ptr<TrackedParamType>>> const&
+                removed)
+        {
+            for (auto const& [item, related, object] : removed)
+            {
+                CustomizerRemoved(item, related, object);
+            }
+            for (auto const& [item, related, object] : modified)
+            {
+                CustomizerModified(item, related, object);
+            }
+
+            std::vector<ServiceReference<S>> references;
+            references.reserve(adding.size());
+            for (auto const& item : adding)
+            {
+                references.push_back(item.first);
+            }
+            auto serviceObjectPointers = customizer->AddingServices(references);
+            if (serviceObjectPointers.size() != references.size())
+            {
+                // Release the objects returned for a reference. Extra objects have no
+                // reference to be released with and are only dropped.
+                for (std::size_t i = 0; i < serviceObjectPointers.size() && i < references.size(); ++i)
+                {
+                    if (serviceObjectPointers[i])
+                    {
+                        customizer->RemovedService(references[i], serviceObjectPointers[i]);
+                    }
+                }
+                throw std::logic_error("The batch customizer must return one object per added item");
+            }
+
+            // Convert the shared pointers to optionals
+            std::vector<std::optional<std::shared_ptr<TrackedParamType>>> objects;
+            objects.reserve(serviceObjectPointers.size());
+            for (auto& serviceObjectPointer : serviceObjectPointers)
+            {
+                objects.push_back(serviceObjectPointer ? std::optional<std::shared_ptr<TrackedParamType>> {
+                                      std::move(serviceObjectPointer) }
+                                                       : std::nullopt);
+            }
+            return objects;
+        }
+
     } // namespace detail
 
 } // namespace cppmicroservices
@@ -42,7 +42,9 @@ namespace cppmicroservices
             Wait(typename MutexHost::UniqueLock& lock)
             {
 #ifdef US_ENABLE_THREADING_SUPPORT
+                lock.EndHold();
                 m_CondVar.wait(lock.m_Lock);
+                lock.BeginHold();
 #else
                 US_UNUSED(lock);
 #endif
@@ -53,7 +55,9 @@ namespace cppmicroservices
             Wait(typename MutexHost::UniqueLock& lock, Predicate pred)
             {
 #ifdef US_ENABLE_THREADING_SUPPORT
+                lock.EndHold();
                 m_CondVar.wait(lock.m_Lock, pred);
+                lock.BeginHold();
 #else
                 US_UNUSED(lock);
                 US_UNUSED(pred);
@@ -72,7 +76,10 @@ namespace cppmicroservices
                 }
                 else
                 {
-                    return m_CondVar.wait_for(lock.m_Lock, rel_time);
+                    lock.EndHold();
+                    auto const status = m_CondVar.wait_for(lock.m_Lock, rel_time);
+                    lock.BeginHold();
+                    return status;
                 }
 #else
                 US_UNUSED(lock);
@@ -95,7 +102,10 @@ namespace cppmicroservices
                 }
                 else
                 {
-                    return m_CondVar.wait_for(lock.m_Lock, rel_time, pred);
+                    lock.EndHold();
+                    bool const result = m_CondVar.wait_for(lock.m_Lock, rel_time, pred);
+                    lock.BeginHold();
+                    return result;
                 }
 #else
                 US_UNUSED(lock);
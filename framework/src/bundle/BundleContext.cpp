@@ -242,11 +242,14 @@ namespace cppmicroservices
         std::weak_ptr<BundlePrivate> const b;
         ServiceReferenceBase const sref;
         std::shared_ptr<S> const service;
+        std::size_t const useStripe;
 
+        // Must be created on the thread which got the service.
         ServiceHolder(std::shared_ptr<BundlePrivate> const& b, ServiceReferenceBase const& sr, std::shared_ptr<S> s)
             : b(b)
             , sref(sr)
             , service(std::move(s))
+            , useStripe(ServiceUseCounter::CurrentStripe())
         {
         }
 
@@ -254,7 +257,7 @@ namespace cppmicroservices
         {
             try
             {
-                sref.d.Load()->UngetService(b.lock(), true);
+                sref.d.Load()->UngetService(b.lock(), true, useStripe);
             }
             catch (...)
             {
@@ -46,9 +46,7 @@ namespace cppmicroservices
             return bundle;
         }
 
-        std::vector<ServiceRegistrationBase> srl;
-        coreCtx->services.Get(us_service_interface_iid<BundleFindHook>(), srl);
-        if (srl.empty())
+        if (!coreCtx->services.GetHooks(us_service_interface_iid<BundleFindHook>()))
         {
             return bundle;
         }
@@ -64,15 +62,17 @@ namespace cppmicroservices
     void
     BundleHooks::FilterBundles(BundleContext const& context, std::vector<Bundle>& bundles) const
     {
-        std::vector<ServiceRegistrationBase> srl;
-        coreCtx->services.Get(us_service_interface_iid<BundleFindHook>(), srl);
+        auto srl = coreCtx->services.GetHooks(us_service_interface_iid<BundleFindHook>());
+        if (!srl)
+        {
+            return;
+        }
         ShrinkableVector<Bundle> filtered(bundles);
 
         auto selfBundle = GetBundleContext().GetBundle();
-        std::sort(srl.begin(), srl.end());
-        for (auto srBaseIter = srl.rbegin(), srBaseEnd = srl.rend(); srBaseIter != srBaseEnd; ++srBaseIter)
+        for (auto const& srBase : *srl)
         {
-            ServiceReference<BundleFindHook> sr = srBaseIter->GetReference();
+            ServiceReference<BundleFindHook> sr = srBase.GetReference();
             std::shared_ptr<BundleFindHook> fh
                 = std::static_pointer_cast<BundleFindHook>(sr.d.Load()->GetService(GetPrivate(selfBundle).get()));
             if (fh)
@@ -94,23 +94,17 @@ namespace cppmicroservices
         }
     }
 
-    void
-    BundleHooks::FilterBundleEventReceivers(BundleEvent const& evt,
-                                            ServiceListeners::BundleListenerMap& bundleListeners)
+    std::shared_ptr<ServiceListeners::BundleListenerMap const>
+    BundleHooks::FilterBundleEventReceivers(BundleEvent const& evt)
     {
-        std::vector<ServiceRegistrationBase> eventHooks;
-        coreCtx->services.Get(us_service_interface_iid<BundleEventHook>(), eventHooks);
+        auto eventHooks = coreCtx->services.GetHooks(us_service_interface_iid<BundleEventHook>());
 
-        {
-            auto l = coreCtx->listeners.bundleListenerMap.Lock();
-            US_UNUSED(l);
-            bundleListeners = coreCtx->listeners.bundleListenerMap.value;
-        }
+        auto bundleListeners = coreCtx->listeners.bundleListenerMap.GetSnapshot();
 
-        if (!eventHooks.empty())
+        if (eventHooks)
         {
             std::vector<BundleContext> bundleContexts;
-            for (auto& le : bundleListeners)
+            for (auto& le : *bundleListeners)
             {
                 bundleContexts.push_back(MakeBundleContext(le.first->shared_from_this()));
             }
@@ -120,8 +114,7 @@ namespace cppmicroservices
             const std::size_t unfilteredSize = bundleContexts.size();
             ShrinkableVector<BundleContext> filtered(bundleContexts);
 
-            std::sort(eventHooks.begin(), eventHooks.end());
-            for (auto iter = eventHooks.rbegin(), iterEnd = eventHooks.rend(); iter != iterEnd; ++iter)
+            for (auto iter = eventHooks->begin(), iterEnd = eventHooks->end(); iter != iterEnd; ++iter)
             {
                 ServiceReference<BundleEventHook> sr;
                 try
@@ -160,21 +153,23 @@ namespace cppmicroservices
 
             if (unfilteredSize != bundleContexts.size())
             {
-                for (auto le = bundleListeners.begin(); le != bundleListeners.end();)
+                // only now is a private copy needed; it holds just the
+                // listeners of the remaining bundle contexts
+                auto filteredListeners = std::make_shared<ServiceListeners::BundleListenerMap>();
+                for (auto& le : *bundleListeners)
                 {
                     if (std::find_if(bundleContexts.begin(),
                                      bundleContexts.end(),
-                                     [&le](BundleContext const& bc) { return GetPrivate(bc) == le->first; })
-                        == bundleContexts.end())
-                    {
-                        bundleListeners.erase(le++);
-                    }
-                    else
+                                     [&le](BundleContext const& bc) { return GetPrivate(bc) == le.first; })
+                        != bundleContexts.end())
                     {
-                        ++le;
+                        filteredListeners->insert(le);
                     }
                 }
+                return filteredListeners;
             }
         }
+
+        return bundleListeners;
     }
 } // namespace cppmicroservices
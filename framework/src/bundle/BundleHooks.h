@@ -49,7 +49,14 @@ namespace cppmicroservices
 
         void FilterBundles(BundleContext const& context, std::vector<Bundle>& bundles) const;
 
-        void FilterBundleEventReceivers(BundleEvent const& evt, ServiceListeners::BundleListenerMap& bundleListeners);
+        /**
+         * Get the bundle listeners which should receive the given event.
+         *
+         * The returned map is the shared listener snapshot, unless a
+         * BundleEventHook removed a bundle context from the receivers, in
+         * which case a filtered copy is returned.
+         */
+        std::shared_ptr<ServiceListeners::BundleListenerMap const> FilterBundleEventReceivers(BundleEvent const& evt);
     };
 } // namespace cppmicroservices
 
@@ -36,6 +36,7 @@
 #include "cppmicroservices/SecurityException.h"
 #include "cppmicroservices/ServiceRegistration.h"
 #include "cppmicroservices/SharedLibraryException.h"
+#include "cppmicroservices/detail/Trace.h"
 
 #include "cppmicroservices/util/Error.h"
 #include "cppmicroservices/util/FileSystem.h"
@@ -52,7 +53,9 @@
 #include <cassert>
 #include <chrono>
 #include <cstring>
+#include <fstream>
 #include <iterator>
+#include <vector>
 
 namespace cppmicroservices
 {
@@ -66,6 +69,15 @@ namespace cppmicroservices
     void
     BundlePrivate::Stop(uint32_t options)
     {
+        if (lazyActivationThread.load() == std::this_thread::get_id())
+        {
+            // Called from the activator started by CompleteLazyActivation(),
+            // which holds the bundle lock. The bundle is stopped once the
+            // activator's Start returns.
+            deferredStopOptions = options;
+            return;
+        }
+
         std::exception_ptr savedException;
 
         {
@@ -105,6 +117,7 @@ namespace cppmicroservices
     std::exception_ptr
     BundlePrivate::Stop0()
     {
+        lazyActivationPending = false;
         wasStarted = state == Bundle::STATE_ACTIVE;
         state = Bundle::STATE_STOPPING;
         operation = OP_DEACTIVATING;
@@ -262,6 +275,20 @@ namespace cppmicroservices
                     // finalization already in progress.
                     return;
                 }
+                if (lazyActivationPending)
+                {
+                    // Waiting for lazy activation, which a start without
+                    // the activation policy triggers right away.
+                    if (!startLazily)
+                    {
+                        auto e = CompleteLazyActivation();
+                        if (e)
+                        {
+                            std::rethrow_exception(e);
+                        }
+                    }
+                    return;
+                }
             }
                 [[fallthrough]];
             case Bundle::STATE_RESOLVED:
@@ -441,6 +468,15 @@ namespace cppmicroservices
             SetAutostartSetting(options);
         }
 
+        startLazily = false;
+        if ((options & Bundle::START_ACTIVATION_POLICY) != 0 || coreCtx->lazyActivation)
+        {
+            auto const& headers = bundleManifest.GetHeaders();
+            auto const policy = headers.find(Constants::BUNDLE_ACTIVATIONPOLICY);
+            startLazily = policy != headers.end() && policy->second.Type() == typeid(std::string)
+                          && any_cast<std::string>(policy->second) == Constants::ACTIVATION_LAZY;
+        }
+
         FinalizeActivation();
         return;
     }
@@ -454,11 +490,9 @@ namespace cppmicroservices
     std::exception_ptr
     BundlePrivate::Start0()
     {
-        // res is used to signal that start did not complete in a normal way
-        std::exception_ptr res;
-        auto const thisBundle = MakeBundle(this->shared_from_this());
-        coreCtx->listeners.BundleChanged(BundleEvent(BundleEvent::BUNDLE_STARTING, thisBundle));
+        detail::TraceSpan span("framework", "StartBundle", symbolicName);
 
+        auto const thisBundle = MakeBundle(this->shared_from_this());
         auto const& headers = thisBundle.GetHeaders();
         Any bundleActivatorVal;
         if (headers.count(Constants::BUNDLE_ACTIVATOR) > 0)
@@ -489,112 +523,43 @@ namespace cppmicroservices
         // Activator in the bundle is not called if 'bundle.activator' property
         // either does not exist or is set to false. If the property is set to true,
         // the actiavtor inside the bundle is called.
+        if (useActivator && startLazily)
+        {
+            // The bundle stays in STARTING until ActivateLazily() loads the
+            // library and starts the activator.
+            lazyActivationPending = true;
+            coreCtx->listeners.BundleChanged(BundleEvent(BundleEvent::BUNDLE_LAZY_ACTIVATION, thisBundle));
+            return nullptr;
+        }
+
+        coreCtx->listeners.BundleChanged(BundleEvent(BundleEvent::BUNDLE_STARTING, thisBundle));
+        return Start1(thisBundle, useActivator);
+    }
+
+    std::exception_ptr
+    BundlePrivate::Start1(Bundle const& thisBundle, bool useActivator)
+    {
+        // res is used to signal that start did not complete in a normal way
+        std::exception_ptr res;
         if (useActivator)
         {
+            std::exception_ptr invalid;
             try
             {
-                if (coreCtx->validationFunc && (lib.GetFilePath() != util::GetExecutablePath())
-                    && !coreCtx->validationFunc(thisBundle))
-                {
-                    StartFailed();
-                    return std::make_exception_ptr(SecurityException {
-                        "Bundle " + symbolicName + " (location=" + location + ") failed bundle validation.",
-                        thisBundle });
-                }
+                invalid = ValidateLibrary(thisBundle);
             }
             catch (...)
             {
-                coreCtx->listeners.SendFrameworkEvent(
-                    FrameworkEvent(FrameworkEvent::Type::FRAMEWORK_WARNING,
-                                   thisBundle,
-                                   "The bundle validation function threw an exception",
-                                   std::current_exception()));
                 StartFailed();
-                throw SecurityException { util::GetLastExceptionStr(), thisBundle };
+                throw;
             }
-
-            try
+            if (invalid)
             {
-                void* libHandle = nullptr;
-                if ((lib.GetFilePath() == util::GetExecutablePath()))
-                {
-                    libHandle = BundleUtils::GetExecutableHandle();
-                }
-                else
-                {
-                    if (!lib.IsLoaded())
-                    {
-                        coreCtx->logger->Log(logservice::SeverityLevel::LOG_INFO,
-                                             "Loading shared library for Bundle " + symbolicName
-                                                 + " (location=" + location + ")");
-                        lib.Load(coreCtx->libraryLoadOptions);
-                        coreCtx->logger->Log(logservice::SeverityLevel::LOG_INFO,
-                                             "Finished loading shared library for Bundle " + symbolicName
-                                                 + " (location=" + location + ")");
-                    }
-                    libHandle = lib.GetHandle();
-                }
-
-                auto ctx = bundleContext.Load();
-
-                // save this bundle's context so that it can be accessible anywhere
-                // from within this bundle's code.
-                std::string set_bundle_context_func = US_STR(US_SET_CTX_PREFIX) + symbolicName;
-                std::string set_bundle_context_err;
-                BundleUtils::GetSymbol(SetBundleContext, libHandle, set_bundle_context_func, set_bundle_context_err);
-
-                if (SetBundleContext)
-                {
-                    SetBundleContext(ctx.get());
-                }
-                else
-                {
-                    coreCtx->logger->Log(logservice::SeverityLevel::LOG_WARNING, set_bundle_context_err);
-                }
-
-                // get the create/destroy activator callbacks
-                std::string create_activator_func = US_STR(US_CREATE_ACTIVATOR_PREFIX) + symbolicName;
-                std::function<BundleActivator*(void)> createActivatorHook;
-                std::string create_activator_err;
-                BundleUtils::GetSymbol(createActivatorHook, libHandle, create_activator_func, create_activator_err);
-
-                std::string destroy_activator_func = US_STR(US_DESTROY_ACTIVATOR_PREFIX) + symbolicName;
-                std::string destroy_activator_err;
-                BundleUtils::GetSymbol(destroyActivatorHook, libHandle, destroy_activator_func, destroy_activator_err);
-
-                if (!createActivatorHook)
-                {
-                    coreCtx->logger->Log(logservice::SeverityLevel::LOG_ERROR, create_activator_err);
-                    throw std::runtime_error("Bundle " + symbolicName + " (location=" + location
-                                             + ") activator constructor not found");
-                }
-                if (!destroyActivatorHook)
-                {
-                    coreCtx->logger->Log(logservice::SeverityLevel::LOG_ERROR, destroy_activator_err);
-                    throw std::runtime_error("Bundle " + symbolicName + " (location=" + location
-                                             + ") activator destructor not found");
-                }
-
-                // get a BundleActivator instance
-                bactivator = std::unique_ptr<BundleActivator, DestroyActivatorHook>(createActivatorHook(),
-                                                                                    destroyActivatorHook);
-                bactivator->Start(MakeBundleContext(ctx));
-            }
-            catch (std::system_error const& ex)
-            {
-                // SharedLibrary::Load(int flags) will throw a std::system_error when a shared library
-                // fails to load. Creating a SharedLibraryException here to throw.
-                res = std::make_exception_ptr(
-                    cppmicroservices::SharedLibraryException(ex.code(), ex.what(), thisBundle));
-            }
-            catch (...)
-            {
-                coreCtx->logger->Log(logservice::SeverityLevel::LOG_INFO,
-                                     "Failed to start Bundle " + symbolicName + " (location=" + location + ")",
-                                     std::current_exception());
-                res = std::make_exception_ptr(std::runtime_error("Bundle " + symbolicName + " (location= " + location
-                                                                 + ") start failed: " + util::GetLastExceptionStr()));
+                StartFailed();
+                return invalid;
             }
+
+            res = StartActivator(thisBundle);
         }
 
         // activator.start() done
@@ -659,6 +624,295 @@ namespace cppmicroservices
         return res;
     }
 
+    std::exception_ptr
+    BundlePrivate::ValidateLibrary(Bundle const& thisBundle)
+    {
+        try
+        {
+            if (coreCtx->validationFunc && (lib.GetFilePath() != util::GetExecutablePath())
+                && !coreCtx->validationFunc(thisBundle))
+            {
+                return std::make_exception_ptr(SecurityException {
+                    "Bundle " + symbolicName + " (location=" + location + ") failed bundle validation.",
+                    thisBundle });
+            }
+        }
+        catch (...)
+        {
+            coreCtx->listeners.SendFrameworkEvent(FrameworkEvent(FrameworkEvent::Type::FRAMEWORK_WARNING,
+                                                                 thisBundle,
+                                                                 "The bundle validation function threw an exception",
+                                                                 std::current_exception()));
+            throw SecurityException { util::GetLastExceptionStr(), thisBundle };
+        }
+        return nullptr;
+    }
+
+    std::exception_ptr
+    BundlePrivate::StartActivator(Bundle const& thisBundle)
+    {
+        std::exception_ptr res;
+        try
+        {
+            // Wait for a background preload of the library. A failed preload
+            // is ignored here; the library is then loaded again below so that
+            // errors are reported the same way as without preloading.
+            if (libPreload.valid())
+            {
+                try
+                {
+                    libPreload.get();
+                }
+                catch (...)
+                {
+                }
+            }
+
+            void* libHandle = nullptr;
+            if ((lib.GetFilePath() == util::GetExecutablePath()))
+            {
+                libHandle = BundleUtils::GetExecutableHandle();
+            }
+            else
+            {
+                if (!lib.IsLoaded())
+                {
+                    coreCtx->logger->Log(logservice::SeverityLevel::LOG_INFO,
+                                         "Loading shared library for Bundle " + symbolicName
+                                             + " (location=" + location + ")");
+                    detail::TraceSpan loadSpan("framework", "LoadLibrary", symbolicName);
+                    auto const loadBegin = std::chrono::steady_clock::now();
+                    lib.Load(coreCtx->libraryLoadOptions);
+                    libLoadTime = std::chrono::steady_clock::now() - loadBegin;
+                    coreCtx->logger->Log(logservice::SeverityLevel::LOG_INFO,
+                                         "Finished loading shared library for Bundle " + symbolicName
+                                             + " (location=" + location + ")");
+                }
+                libHandle = lib.GetHandle();
+            }
+
+            if (!activatorSymbols.resolved)
+            {
+                ResolveActivatorSymbols(libHandle);
+            }
+
+            auto ctx = bundleContext.Load();
+
+            // save this bundle's context so that it can be accessible anywhere
+            // from within this bundle's code.
+            if (SetBundleContext)
+            {
+                SetBundleContext(ctx.get());
+            }
+            else
+            {
+                coreCtx->logger->Log(logservice::SeverityLevel::LOG_WARNING,
+                                     activatorSymbols.setBundleContextErr);
+            }
+
+            if (!activatorSymbols.createActivatorHook)
+            {
+                coreCtx->logger->Log(logservice::SeverityLevel::LOG_ERROR, activatorSymbols.createActivatorErr);
+                throw std::runtime_error("Bundle " + symbolicName + " (location=" + location
+                                         + ") activator constructor not found");
+            }
+            if (!destroyActivatorHook)
+            {
+                coreCtx->logger->Log(logservice::SeverityLevel::LOG_ERROR, activatorSymbols.destroyActivatorErr);
+                throw std::runtime_error("Bundle " + symbolicName + " (location=" + location
+                                         + ") activator destructor not found");
+            }
+
+            // get a BundleActivator instance
+            auto const startBegin = std::chrono::steady_clock::now();
+            {
+                detail::TraceSpan activatorSpan("framework", "BundleActivator::Start", symbolicName);
+                bactivator = std::unique_ptr<BundleActivator, DestroyActivatorHook>(
+                    activatorSymbols.createActivatorHook(),
+                    destroyActivatorHook);
+                bactivator->Start(MakeBundleContext(ctx));
+            }
+            activatorStartTime = std::chrono::steady_clock::now() - startBegin;
+
+            DIAG_LOG(*coreCtx->sink) << "Bundle " << symbolicName << " started: library load "
+                                     << std::chrono::duration_cast<std::chrono::microseconds>(libLoadTime).count()
+                                     << " us, activator start "
+                                     << std::chrono::duration_cast<std::chrono::microseconds>(activatorStartTime)
+                                            .count()
+                                     << " us";
+        }
+        catch (std::system_error const& ex)
+        {
+            // SharedLibrary::Load(int flags) will throw a std::system_error when a shared library
+            // fails to load. Creating a SharedLibraryException here to throw.
+            res = std::make_exception_ptr(
+                cppmicroservices::SharedLibraryException(ex.code(), ex.what(), thisBundle));
+        }
+        catch (...)
+        {
+            coreCtx->logger->Log(logservice::SeverityLevel::LOG_INFO,
+                                 "Failed to start Bundle " + symbolicName + " (location=" + location + ")",
+                                 std::current_exception());
+            res = std::make_exception_ptr(std::runtime_error("Bundle " + symbolicName + " (location= " + location
+                                                             + ") start failed: " + util::GetLastExceptionStr()));
+        }
+        return res;
+    }
+
+    void
+    BundlePrivate::ActivateLazily()
+    {
+        if (!lazyActivationPending)
+        {
+            return;
+        }
+
+        auto l = this->Lock();
+        US_UNUSED(l);
+        if (!lazyActivationPending || state != Bundle::STATE_STARTING)
+        {
+            return;
+        }
+
+        auto res = CompleteLazyActivation();
+        if (res)
+        {
+            coreCtx->listeners.SendFrameworkEvent(FrameworkEvent(FrameworkEvent::Type::FRAMEWORK_ERROR,
+                                                                 MakeBundle(this->shared_from_this()),
+                                                                 "Lazy activation of bundle " + symbolicName
+                                                                     + " (location=" + location + ") failed",
+                                                                 res));
+        }
+    }
+
+    std::exception_ptr
+    BundlePrivate::CompleteLazyActivation()
+    {
+        lazyActivationPending = false;
+        operation = OP_ACTIVATING;
+        lazyActivationThread = std::this_thread::get_id();
+
+        std::exception_ptr res;
+        try
+        {
+            auto const thisBundle = MakeBundle(this->shared_from_this());
+            coreCtx->listeners.BundleChanged(BundleEvent(BundleEvent::BUNDLE_STARTING, thisBundle));
+            res = Start1(thisBundle, true);
+        }
+        catch (...)
+        {
+            res = std::current_exception();
+        }
+
+        lazyActivationThread = std::thread::id();
+        operation = OP_IDLE;
+
+        if (deferredStopOptions)
+        {
+            // the activator stopped its own bundle
+            auto const options = *deferredStopOptions;
+            deferredStopOptions.reset();
+            if ((options & Bundle::STOP_TRANSIENT) == 0)
+            {
+                SetAutostartSetting(-1);
+            }
+            if (state == Bundle::STATE_ACTIVE)
+            {
+                auto stopException = Stop0();
+                if (!res)
+                {
+                    res = stopException;
+                }
+            }
+        }
+        return res;
+    }
+
+    void
+    BundlePrivate::PreloadLibrary()
+    {
+        using LibraryPreload = CoreBundleContext::LibraryPreload;
+
+        auto const mode = coreCtx->libraryPreload;
+        if (mode == LibraryPreload::NONE || !barchive || !barchive->IsValid())
+        {
+            return;
+        }
+
+        // Only bundles with an activator get their library loaded by Start0().
+        auto const& headers = bundleManifest.GetHeaders();
+        auto const activatorIter = headers.find(Constants::BUNDLE_ACTIVATOR);
+        if (activatorIter == headers.end() || activatorIter->second.Type() != typeid(bool)
+            || !any_cast<bool>(activatorIter->second))
+        {
+            return;
+        }
+
+        auto const libPath = lib.GetFilePath();
+        try
+        {
+            if (libPath == util::GetExecutablePath())
+            {
+                return;
+            }
+        }
+        catch (...)
+        {
+            return;
+        }
+
+        if (mode == LibraryPreload::PREFETCH)
+        {
+            libPreload = coreCtx->libraryPreloadPool.Submit(
+                [libPath]()
+                {
+                    // Read the whole file once to pull its pages into the OS file cache.
+                    std::ifstream libFile(libPath, std::ios_base::in | std::ios_base::binary);
+                    std::vector<char> buffer(1 << 20);
+                    while (libFile.read(buffer.data(), buffer.size()))
+                    {
+                    }
+                });
+        }
+        else
+        {
+            auto const loadOptions = coreCtx->libraryLoadOptions;
+            libPreload = coreCtx->libraryPreloadPool.Submit(
+                [this, loadOptions]()
+                {
+                    auto const loadBegin = std::chrono::steady_clock::now();
+                    lib.Load(loadOptions);
+                    libLoadTime = std::chrono::steady_clock::now() - loadBegin;
+                    ResolveActivatorSymbols(lib.GetHandle());
+                });
+        }
+    }
+
+    void
+    BundlePrivate::ResolveActivatorSymbols(void* libHandle)
+    {
+        std::string set_bundle_context_func = US_STR(US_SET_CTX_PREFIX) + symbolicName;
+        BundleUtils::GetSymbol(SetBundleContext,
+                               libHandle,
+                               set_bundle_context_func,
+                               activatorSymbols.setBundleContextErr);
+
+        // get the create/destroy activator callbacks
+        std::string create_activator_func = US_STR(US_CREATE_ACTIVATOR_PREFIX) + symbolicName;
+        BundleUtils::GetSymbol(activatorSymbols.createActivatorHook,
+                               libHandle,
+                               create_activator_func,
+                               activatorSymbols.createActivatorErr);
+
+        std::string destroy_activator_func = US_STR(US_DESTROY_ACTIVATOR_PREFIX) + symbolicName;
+        BundleUtils::GetSymbol(destroyActivatorHook,
+                               libHandle,
+                               destroy_activator_func,
+                               activatorSymbols.destroyActivatorErr);
+
+        activatorSymbols.resolved = true;
+    }
+
     void
     BundlePrivate::StartFailed()
     {
@@ -696,6 +950,13 @@ namespace cppmicroservices
         , bundleManifest()
         , lib()
         , SetBundleContext(nullptr)
+        , activatorSymbols()
+        , libLoadTime(std::chrono::steady_clock::duration::zero())
+        , activatorStartTime(std::chrono::steady_clock::duration::zero())
+        , startLazily(false)
+        , lazyActivationPending(false)
+        , lazyActivationThread(std::thread::id())
+        , libPreload()
     {
     }
 
@@ -719,6 +980,13 @@ namespace cppmicroservices
         , bundleManifest(ba->GetInjectedManifest())
         , lib(location)
         , SetBundleContext(nullptr)
+        , activatorSymbols()
+        , libLoadTime(std::chrono::steady_clock::duration::zero())
+        , activatorStartTime(std::chrono::steady_clock::duration::zero())
+        , startLazily(false)
+        , lazyActivationPending(false)
+        , lazyActivationThread(std::thread::id())
+        , libPreload()
     {
         // Only take the time to read the manifest out of the BundleArchive file if we don't already have
         // a manifest.
@@ -733,6 +1001,7 @@ namespace cppmicroservices
                     BundleResourceStream manifestStream(manifestRes);
                     try
                     {
+                        detail::TraceSpan span("framework", "ParseManifest", location);
                         bundleManifest.Parse(manifestStream);
                     }
                     catch (...)
@@ -802,7 +1071,14 @@ namespace cppmicroservices
         }
     }
 
-    BundlePrivate::~BundlePrivate() = default;
+    BundlePrivate::~BundlePrivate()
+    {
+        // a queued or running preload may still refer to this bundle
+        if (libPreload.valid())
+        {
+            libPreload.wait();
+        }
+    }
 
     void
     BundlePrivate::CheckUninstalled() const
@@ -843,7 +1119,7 @@ namespace cppmicroservices
             try
             {
                 auto ref = i->GetReference(std::string());
-                ref.d.Load()->UngetService(this->shared_from_this(), false);
+                ref.d.Load()->UngetService(this->shared_from_this(), false, 0);
             }
             catch (...)
             {
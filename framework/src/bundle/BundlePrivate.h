@@ -33,8 +33,13 @@
 #include "BundleArchive.h"
 #include "BundleManifest.h"
 
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <ostream>
 #include <thread>
 
@@ -159,8 +164,56 @@ namespace cppmicroservices
          */
         std::exception_ptr Start0();
 
+        /**
+         * Validates the library and starts the activator, if useActivator is
+         * true, then moves the bundle from STARTING to ACTIVE.
+         */
+        std::exception_ptr Start1(Bundle const& thisBundle, bool useActivator);
+
         void StartFailed();
 
+        /**
+         * Loads the library and starts the activator of a bundle waiting in
+         * STARTING according to its lazy activation policy. Does nothing if
+         * the bundle's activation is not pending. Errors are reported as
+         * framework events.
+         */
+        void ActivateLazily();
+
+        /**
+         * Runs the STARTING to ACTIVE transition of a bundle waiting for lazy
+         * activation. Must be called with the bundle lock held.
+         */
+        std::exception_ptr CompleteLazyActivation();
+
+        /**
+         * Prefetches or loads the bundle's shared library on a background
+         * thread, according to CoreBundleContext::libraryPreload. Must be
+         * called before the bundle is visible to other threads.
+         */
+        void PreloadLibrary();
+
+        /**
+         * Looks up the activator entry points in the given library and
+         * caches them in activatorSymbols.
+         */
+        void ResolveActivatorSymbols(void* libHandle);
+
+        /**
+         * Runs the framework's bundle validation function, if any.
+         *
+         * \return a SecurityException if the bundle failed validation
+         */
+        std::exception_ptr ValidateLibrary(Bundle const& thisBundle);
+
+        /**
+         * Loads the bundle's shared library and creates and starts its
+         * BundleActivator.
+         *
+         * \return the exception which made the activation fail
+         */
+        std::exception_ptr StartActivator(Bundle const& thisBundle);
+
         /**
          * Framework context.
          */
@@ -270,6 +323,56 @@ namespace cppmicroservices
         SharedLibrary lib;
 
         SetBundleContextFn SetBundleContext;
+
+        /**
+         * Activator entry points of the bundle. Resolved once, since the
+         * bundle's shared library is never unloaded.
+         */
+        struct ActivatorSymbols
+        {
+            bool resolved = false;
+            std::function<BundleActivator*(void)> createActivatorHook;
+            std::string setBundleContextErr;
+            std::string createActivatorErr;
+            std::string destroyActivatorErr;
+        };
+
+        ActivatorSymbols activatorSymbols;
+
+        /**
+         * Time spent loading the shared library, and in BundleActivator::Start
+         * during the last start of the bundle.
+         */
+        std::chrono::steady_clock::duration libLoadTime;
+        std::chrono::steady_clock::duration activatorStartTime;
+
+        /**
+         * Set by Start() when the bundle is to be started according to its
+         * declared lazy activation policy.
+         */
+        bool startLazily;
+
+        /**
+         * True while a lazily started bundle waits in STARTING for its
+         * activator to be started. Changed while holding the bundle lock and
+         * read without it by ActivateLazily().
+         */
+        std::atomic<bool> lazyActivationPending;
+
+        /**
+         * The thread running BundleActivator::Start from
+         * CompleteLazyActivation(), and the options of a Stop() it called on
+         * this bundle. That stop is carried out once Start returns, as the
+         * thread already holds the bundle lock.
+         */
+        std::atomic<std::thread::id> lazyActivationThread;
+        std::optional<uint32_t> deferredStopOptions;
+
+        /**
+         * Pending background preload of the shared library, running on
+         * CoreBundleContext::libraryPreloadPool. The destructor waits for it.
+         */
+        std::future<void> libPreload;
     };
 
     Bundle MakeBundle(std::shared_ptr<BundlePrivate> const& d);
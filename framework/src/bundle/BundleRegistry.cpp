@@ -27,6 +27,7 @@
 #include "cppmicroservices/BundleEvent.h"
 #include "cppmicroservices/FrameworkEvent.h"
 #include "cppmicroservices/GetBundleContext.h"
+#include "cppmicroservices/detail/Trace.h"
 
 #include "cppmicroservices/util/Error.h"
 #include "cppmicroservices/util/String.h"
@@ -62,14 +63,30 @@ namespace
 namespace cppmicroservices
 {
 
-    BundleRegistry::BundleRegistry(CoreBundleContext* coreCtx) : coreCtx(coreCtx) {}
+    namespace
+    {
+        detail::LockSite registryLockSite("BundleRegistry");
+        detail::LockSite bundlesLockSite("BundleRegistry::bundles");
+    } // namespace
+
+    BundleRegistry::BundleRegistry(CoreBundleContext* coreCtx) : coreCtx(coreCtx)
+    {
+        SetLockSite(&registryLockSite);
+        bundles.SetLockSite(&bundlesLockSite);
+    }
 
-    BundleRegistry::~BundleRegistry() = default;
+    BundleRegistry::~BundleRegistry()
+    {
+        SetLockSite(nullptr);
+        bundles.SetLockSite(nullptr);
+    }
 
     void
     BundleRegistry::Init()
     {
-        bundles.v.insert(std::make_pair(coreCtx->systemBundle->location, coreCtx->systemBundle));
+        auto l = bundles.Lock();
+        US_UNUSED(l);
+        InsertBundle(coreCtx->systemBundle);
     }
 
     void
@@ -78,6 +95,9 @@ namespace cppmicroservices
         auto l = bundles.Lock();
         US_UNUSED(l);
         bundles.v.clear();
+        bundles.byId.clear();
+        bundles.bySymbolicName.clear();
+        bundles.snapshot.reset();
     }
 
     /*
@@ -143,6 +163,8 @@ namespace cppmicroservices
     {
         using namespace std::chrono_literals;
 
+        detail::TraceSpan span("framework", "InstallBundle", location);
+
         CheckIllegalState();
 
         // Grab the lock for the BundleRegistry object so that we can
@@ -350,6 +372,13 @@ namespace cppmicroservices
             for (auto const& ba : barchives)
             {
                 auto d = std::make_shared<BundlePrivate>(coreCtx, ba);
+                // All bundles at this location share one file, so prefetching it
+                // once is enough. Loading is done per bundle.
+                if (installedBundles.empty()
+                    || coreCtx->libraryPreload == CoreBundleContext::LibraryPreload::LOAD)
+                {
+                    d->PreloadLibrary();
+                }
                 installedBundles.emplace_back(MakeBundle(d));
             }
 
@@ -360,7 +389,7 @@ namespace cppmicroservices
                 US_UNUSED(l);
                 for (auto& b : installedBundles)
                 {
-                    bundles.v.insert(std::make_pair(location, b.d));
+                    InsertBundle(b.d);
                 }
             }
 
@@ -394,12 +423,51 @@ namespace cppmicroservices
         {
             if (iter->second->id == id)
             {
+                auto nameRange = bundles.bySymbolicName.equal_range(iter->second->symbolicName);
+                for (auto nameIter = nameRange.first; nameIter != nameRange.second; ++nameIter)
+                {
+                    if (nameIter->second == iter->second)
+                    {
+                        bundles.bySymbolicName.erase(nameIter);
+                        break;
+                    }
+                }
+                bundles.byId.erase(id);
                 bundles.v.erase(iter);
+                bundles.snapshot.reset();
                 return;
             }
         }
     }
 
+    void
+    BundleRegistry::InsertBundle(std::shared_ptr<BundlePrivate> const& b)
+    {
+        bundles.v.insert(std::make_pair(b->location, b));
+        bundles.byId[b->id] = b;
+        bundles.bySymbolicName.insert(std::make_pair(b->symbolicName, b));
+        bundles.snapshot.reset();
+    }
+
+    std::shared_ptr<BundleRegistry::BundleList const>
+    BundleRegistry::GetBundlesSnapshot() const
+    {
+        auto l = bundles.Lock();
+        US_UNUSED(l);
+
+        if (!bundles.snapshot)
+        {
+            auto snapshot = std::make_shared<BundleList>();
+            snapshot->reserve(bundles.v.size());
+            std::transform(bundles.v.begin(),
+                           bundles.v.end(),
+                           std::back_inserter(*snapshot),
+                           [](BundleMap::value_type const& p) { return p.second; });
+            bundles.snapshot = std::move(snapshot);
+        }
+        return bundles.snapshot;
+    }
+
     std::shared_ptr<BundlePrivate>
     BundleRegistry::GetBundle(long id) const
     {
@@ -408,14 +476,8 @@ namespace cppmicroservices
         auto l = bundles.Lock();
         US_UNUSED(l);
 
-        for (auto& m : bundles.v)
-        {
-            if (m.second->id == id)
-            {
-                return m.second;
-            }
-        }
-        return nullptr;
+        auto iter = bundles.byId.find(id);
+        return iter == bundles.byId.end() ? nullptr : iter->second;
     }
 
     std::vector<std::shared_ptr<BundlePrivate>>
@@ -445,12 +507,12 @@ namespace cppmicroservices
         auto l = bundles.Lock();
         US_UNUSED(l);
 
-        for (auto& p : bundles.v)
+        auto range = bundles.bySymbolicName.equal_range(name);
+        for (auto iter = range.first; iter != range.second; ++iter)
         {
-            auto& b = p.second;
-            if (name == b->symbolicName && version == b->version)
+            if (version == iter->second->version)
             {
-                res.push_back(b);
+                res.push_back(iter->second);
             }
         }
 
@@ -460,15 +522,7 @@ namespace cppmicroservices
     std::vector<std::shared_ptr<BundlePrivate>>
     BundleRegistry::GetBundles() const
     {
-        auto l = bundles.Lock();
-        US_UNUSED(l);
-
-        std::vector<std::shared_ptr<BundlePrivate>> result;
-        std::transform(bundles.v.begin(),
-                       bundles.v.end(),
-                       std::back_inserter(result),
-                       [](BundleMap::value_type const& p) { return p.second; });
-        return result;
+        return *GetBundlesSnapshot();
     }
 
     std::vector<std::shared_ptr<BundlePrivate>>
@@ -477,14 +531,12 @@ namespace cppmicroservices
         CheckIllegalState();
         std::vector<std::shared_ptr<BundlePrivate>> result;
 
-        auto l = bundles.Lock();
-        US_UNUSED(l);
-        for (auto& b : bundles.v)
+        for (auto const& b : *GetBundlesSnapshot())
         {
-            auto s = b.second->state.load();
+            auto s = b->state.load();
             if (s == Bundle::STATE_ACTIVE || s == Bundle::STATE_STARTING)
             {
-                result.push_back(b.second);
+                result.push_back(b);
             }
         }
         return result;
@@ -501,7 +553,9 @@ namespace cppmicroservices
             try
             {
                 auto impl = std::make_shared<BundlePrivate>(coreCtx, ba);
-                bundles.v.insert(std::make_pair(impl->location, impl));
+                auto bl = bundles.Lock();
+                US_UNUSED(bl);
+                InsertBundle(impl);
             }
             catch (...)
             {
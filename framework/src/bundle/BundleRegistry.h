@@ -30,6 +30,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "BundleResourceContainer.h"
@@ -131,6 +132,7 @@ namespace cppmicroservices
 
       private:
         using BundleMap = std::multimap<std::string, std::shared_ptr<BundlePrivate>>;
+        using BundleList = std::vector<std::shared_ptr<BundlePrivate>>;
 
         // don't allow copying the BundleRegistry.
         BundleRegistry(BundleRegistry const&) = delete;
@@ -161,6 +163,18 @@ namespace cppmicroservices
             std::vector<Bundle>& res,
             std::vector<std::string>& alreadyInstalled);
 
+        /**
+         * Adds a bundle to the bundle table and its indexes.
+         * The bundles lock must be held.
+         */
+        void InsertBundle(std::shared_ptr<BundlePrivate> const& b);
+
+        /**
+         * Returns the current list of all bundles. The list is rebuilt
+         * after the bundle table changed and shared otherwise.
+         */
+        std::shared_ptr<BundleList const> GetBundlesSnapshot() const;
+
         void DecrementInitialBundleMapRef(cppmicroservices::detail::MutexLockingStrategy<>::UniqueLock& l,
                                           std::string const& location);
 
@@ -194,6 +208,15 @@ namespace cppmicroservices
         struct : MultiThreaded<>
         {
             BundleMap v;
+
+            /** Index of v by bundle id. */
+            std::unordered_map<long, std::shared_ptr<BundlePrivate>> byId;
+
+            /** Index of v by bundle symbolic name. */
+            std::unordered_multimap<std::string, std::shared_ptr<BundlePrivate>> bySymbolicName;
+
+            /** All bundles in v, or null if v changed since it was taken. */
+            mutable std::shared_ptr<BundleList const> snapshot;
         } bundles;
     };
 } // namespace cppmicroservices
@@ -27,8 +27,11 @@
 
 #include "BundleArchive.h"
 #include "BundleResourceContainer.h"
+#include "BundleResourceReader.h"
 
+#include <algorithm>
 #include <atomic>
+#include <climits>
 #include <string>
 #include <utility>
 
@@ -253,13 +256,13 @@ namespace cppmicroservices
     int
     BundleResource::GetSize() const
     {
-        return d->stat.uncompressedSize;
+        return static_cast<int>(std::min<uint64_t>(d->stat.uncompressedSize, INT_MAX));
     }
 
     int
     BundleResource::GetCompressedSize() const
     {
-        return d->stat.compressedSize;
+        return static_cast<int>(std::min<uint64_t>(d->stat.compressedSize, INT_MAX));
     }
 
     time_t
@@ -291,6 +294,17 @@ namespace cppmicroservices
         return d->archive->GetResourceContainer()->GetData(d->stat.index);
     }
 
+    std::unique_ptr<BundleResourceReader>
+    BundleResource::GetReader() const
+    {
+        if (!IsValid())
+        {
+            return nullptr;
+        }
+
+        return std::make_unique<BundleResourceReader>(d->archive->GetResourceContainer(), d->stat.index);
+    }
+
     std::ostream&
     operator<<(std::ostream& os, BundleResource const& resource)
     {
@@ -22,11 +22,13 @@
 
 #include "cppmicroservices/detail/BundleResourceBuffer.h"
 
+#include "BundleResourceReader.h"
+
 #include <cassert>
 #include <cstdint>
 #include <cstdlib>
-#include <limits>
 #include <memory>
+#include <vector>
 
 #ifdef US_PLATFORM_WINDOWS
 #    define DATA_NEEDS_NEWLINE_CONVERSION 1
@@ -42,6 +44,14 @@ namespace cppmicroservices
     namespace detail
     {
 
+        namespace
+        {
+            // Binary resources larger than this are read incrementally.
+            constexpr uint64_t STREAMING_THRESHOLD = 256 * 1024;
+            // Size of the window used to read incrementally.
+            constexpr std::size_t STREAMING_WINDOW_SIZE = 64 * 1024;
+        } // namespace
+
         class BundleResourceBufferPrivate
         {
           public:
@@ -54,6 +64,23 @@ namespace cppmicroservices
                 , current(begin)
                 , mode(mode)
                 , uncompressedData(reinterpret_cast<unsigned char*>(data.release()), data.get_deleter())
+                , reader()
+                , windowOffset(0)
+#ifdef DATA_NEEDS_NEWLINE_CONVERSION
+                , pos(0)
+#endif
+            {
+            }
+
+            BundleResourceBufferPrivate(std::unique_ptr<BundleResourceReader> reader, std::ios_base::openmode mode)
+                : begin(nullptr)
+                , end(nullptr)
+                , current(nullptr)
+                , mode(mode)
+                , uncompressedData(nullptr, ::free)
+                , reader(std::move(reader))
+                , window(STREAMING_WINDOW_SIZE)
+                , windowOffset(0)
 #ifdef DATA_NEEDS_NEWLINE_CONVERSION
                 , pos(0)
 #endif
@@ -68,6 +95,13 @@ namespace cppmicroservices
 
             std::unique_ptr<unsigned char, void (*)(void*)> uncompressedData;
 
+            // Only set when the resource is read incrementally. The get area
+            // is then a window into the resource data.
+            std::unique_ptr<BundleResourceReader> reader;
+            std::vector<char> window;
+            // Resource offset of the first character of the get area.
+            std::streambuf::off_type windowOffset;
+
 #ifdef DATA_NEEDS_NEWLINE_CONVERSION
             // records the stream position ignoring CR characters
             std::streambuf::pos_type pos;
@@ -79,8 +113,35 @@ namespace cppmicroservices
                                                    std::ios_base::openmode mode)
             : d(nullptr)
         {
-            assert(_size < static_cast<std::size_t>(std::numeric_limits<uint32_t>::max()));
+            Init(std::move(data), _size, mode);
+        }
+
+        BundleResourceBuffer::BundleResourceBuffer(std::unique_ptr<BundleResourceReader> reader,
+                                                   std::ios_base::openmode mode)
+            : d(nullptr)
+        {
+            if (!reader)
+            {
+                Init({ nullptr, ::free }, 0, mode);
+            }
+            else if ((mode & std::ios_base::binary) && reader->GetSize() > STREAMING_THRESHOLD)
+            {
+                d = std::make_unique<BundleResourceBufferPrivate>(std::move(reader), mode);
+                auto* window = d->window.data();
+                setg(window, window, window);
+            }
+            else
+            {
+                auto const size = static_cast<std::size_t>(reader->GetSize());
+                Init(reader->ReadAll(), size, mode);
+            }
+        }
 
+        void
+        BundleResourceBuffer::Init(std::unique_ptr<void, void (*)(void*)> data,
+                                   std::size_t _size,
+                                   std::ios_base::openmode mode)
+        {
             auto* begin = reinterpret_cast<char*>(data.get());
             std::size_t size = begin ? _size : 0;
 
@@ -100,6 +161,16 @@ namespace cppmicroservices
 #endif
 
             d = std::make_unique<BundleResourceBufferPrivate>(std::move(data), size, begin, mode);
+
+            // In binary mode no character conversion takes place, so the
+            // whole resource is exposed as the get area. This lets readers
+            // (e.g. operator<<(std::streambuf*) or sgetn) access the data in
+            // bulk instead of character by character.
+            if (mode & std::ios_base::binary)
+            {
+                auto* data_begin = const_cast<char*>(d->begin);
+                setg(data_begin, data_begin, data_begin + size);
+            }
         }
 
         BundleResourceBuffer::~BundleResourceBuffer() = default;
@@ -107,6 +178,19 @@ namespace cppmicroservices
         BundleResourceBuffer::int_type
         BundleResourceBuffer::underflow()
         {
+            if (d->mode & std::ios_base::binary)
+            {
+                if (gptr() == egptr() && d->reader)
+                {
+                    // move the window past the consumed data and refill it
+                    d->windowOffset += egptr() - eback();
+                    auto* window = d->window.data();
+                    auto const n = d->reader->Read(window, d->window.size());
+                    setg(window, window, window + n);
+                }
+                return gptr() < egptr() ? traits_type::to_int_type(*gptr()) : traits_type::eof();
+            }
+
             if (d->current == d->end)
                 return traits_type::eof();
 
@@ -132,6 +216,17 @@ namespace cppmicroservices
         BundleResourceBuffer::int_type
         BundleResourceBuffer::uflow()
         {
+            if (d->mode & std::ios_base::binary)
+            {
+                if (traits_type::eq_int_type(underflow(), traits_type::eof()))
+                {
+                    return traits_type::eof();
+                }
+                int_type c = traits_type::to_int_type(*gptr());
+                gbump(1);
+                return c;
+            }
+
             if (d->current == d->end)
                 return traits_type::eof();
 
@@ -157,6 +252,12 @@ namespace cppmicroservices
         BundleResourceBuffer::int_type
         BundleResourceBuffer::pbackfail(int_type ch)
         {
+            if (d->mode & std::ios_base::binary)
+            {
+                // sputbackc already handles all valid put backs within the get area
+                return traits_type::eof();
+            }
+
             int backOffset = -1;
 #ifdef DATA_NEEDS_NEWLINE_CONVERSION
             if (!(d->mode & std::ios_base::binary))
@@ -180,6 +281,16 @@ namespace cppmicroservices
         std::streamsize
         BundleResourceBuffer::showmanyc()
         {
+            if (d->mode & std::ios_base::binary)
+            {
+                if (d->reader)
+                {
+                    return static_cast<std::streamsize>(d->reader->GetSize())
+                           - (d->windowOffset + (gptr() - eback()));
+                }
+                return egptr() - gptr();
+            }
+
             assert(d->current <= d->end);
 
 #ifdef DATA_NEEDS_NEWLINE_CONVERSION
@@ -203,6 +314,42 @@ namespace cppmicroservices
                                       std::ios_base::seekdir way,
                                       std::ios_base::openmode /*which*/)
         {
+            if (d->mode & std::ios_base::binary)
+            {
+                std::streambuf::off_type const windowSize = egptr() - eback();
+                std::streambuf::off_type const size
+                    = d->reader ? static_cast<std::streambuf::off_type>(d->reader->GetSize()) : windowSize;
+                std::streambuf::off_type pos = off;
+                if (way == std::ios_base::cur)
+                {
+                    pos += d->windowOffset + (gptr() - eback());
+                }
+                else if (way == std::ios_base::end)
+                {
+                    pos += size;
+                }
+                if (pos < 0 || pos > size)
+                {
+                    return std::streambuf::pos_type(std::streambuf::off_type(-1));
+                }
+                if (pos >= d->windowOffset && pos <= d->windowOffset + windowSize)
+                {
+                    setg(eback(), eback() + (pos - d->windowOffset), egptr());
+                }
+                else
+                {
+                    // outside of the window; the next underflow() reads from pos
+                    if (!d->reader->Seek(static_cast<uint64_t>(pos)))
+                    {
+                        return std::streambuf::pos_type(std::streambuf::off_type(-1));
+                    }
+                    d->windowOffset = pos;
+                    auto* window = d->window.data();
+                    setg(window, window, window);
+                }
+                return pos;
+            }
+
 #ifdef DATA_NEEDS_NEWLINE_CONVERSION
             std::streambuf::off_type step = 1;
             if (way == std::ios_base::beg)
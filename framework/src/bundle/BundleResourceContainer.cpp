@@ -29,12 +29,10 @@
 #include "cppmicroservices/GetBundleContext.h"
 #include "cppmicroservices/detail/Log.h"
 
-#include <cassert>
-#include <climits>
+#include <algorithm>
 #include <cstring>
 #include <exception>
 #include <fstream>
-#include <sstream>
 #include <stdexcept>
 
 namespace cppmicroservices
@@ -46,6 +44,7 @@ namespace cppmicroservices
         , m_ObjFile()
         , m_ZipFileMutex()
         , m_IsContainerOpen(false)
+        , m_OpenReaders(0)
     {
         // Ensure that the location exists even if we are injecting a manifest.
 
@@ -126,13 +125,8 @@ namespace cppmicroservices
                 = mz_zip_reader_is_file_a_directory(const_cast<mz_zip_archive*>(&m_ZipArchive), index) ? true : false;
             stat.modifiedTime = zipStat.m_time;
             stat.crc32 = zipStat.m_crc32;
-            // This will limit the size info from uint64 to uint32 on 32-bit
-            // architectures. We don't care because we assume resources > 2GB
-            // don't make sense to be embedded in a bundle anyway.
-            assert(zipStat.m_comp_size < INT_MAX);
-            assert(zipStat.m_uncomp_size < INT_MAX);
-            stat.compressedSize = static_cast<int>(zipStat.m_comp_size);
-            stat.uncompressedSize = static_cast<int>(zipStat.m_uncomp_size);
+            stat.compressedSize = zipStat.m_comp_size;
+            stat.uncompressedSize = zipStat.m_uncomp_size;
             return true;
         }
         return false;
@@ -142,7 +136,14 @@ namespace cppmicroservices
     BundleResourceContainer::GetData(int index)
     {
         OpenAndInitializeContainer();
-        std::unique_lock<std::mutex> l(m_ZipFileStreamMutex);
+        // Reading an archive held in memory keeps no stream state, so stored
+        // entries are copied, and compressed ones inflated, without serializing
+        // concurrent reads on the stream mutex.
+        std::unique_lock<std::mutex> l(m_ZipFileStreamMutex, std::defer_lock);
+        if (m_ZipArchive.m_zip_type != MZ_ZIP_TYPE_MEMORY)
+        {
+            l.lock();
+        }
         void* data = mz_zip_reader_extract_to_heap(const_cast<mz_zip_archive*>(&m_ZipArchive), index, nullptr, 0);
         return { data, ::free };
     }
@@ -153,34 +154,24 @@ namespace cppmicroservices
                                          std::vector<std::string>& names,
                                          std::vector<uint32_t>& indices) const
     {
-        auto iter = m_SortedEntries.find(std::make_pair(resourcePath, 0));
-        if (iter == m_SortedEntries.end())
+        auto const* children = FindChildren(resourcePath);
+        if (children == nullptr)
         {
             return;
         }
 
-        for (++iter; iter != m_SortedEntries.end(); ++iter)
+        for (auto i = children->begin; i != children->end; ++i)
         {
-            if (resourcePath.size() > iter->first.size())
+            auto const& entry = m_SortedEntries[m_DirChildren[i]];
+            if (relativePaths)
             {
-                break;
+                names.push_back(entry.first.substr(resourcePath.size()));
             }
-            if (iter->first.compare(0, resourcePath.size(), resourcePath) == 0)
+            else
             {
-                std::size_t pos = iter->first.find_first_of('/', resourcePath.size());
-                if (pos == std::string::npos || pos == iter->first.size() - 1)
-                {
-                    if (relativePaths)
-                    {
-                        names.push_back(iter->first.substr(resourcePath.size()));
-                    }
-                    else
-                    {
-                        names.push_back(iter->first);
-                    }
-                    indices.push_back(iter->second);
-                }
+                names.push_back(entry.first);
             }
+            indices.push_back(entry.second);
         }
     }
 
@@ -191,26 +182,52 @@ namespace cppmicroservices
                                        bool recurse,
                                        std::vector<BundleResource>& resources) const
     {
-        std::vector<std::string> names;
-        std::vector<uint32_t> indices;
-
         OpenAndInitializeContainer();
 
-        this->GetChildren(path, true, names, indices);
+        auto const* children = FindChildren(path);
+        if (children != nullptr)
+        {
+            this->FindNodes(archive, *children, CompilePattern(filePattern), recurse, resources);
+        }
+    }
 
-        for (std::size_t i = 0, s = names.size(); i < s; ++i)
+    void
+    BundleResourceContainer::FindNodes(std::shared_ptr<BundleArchive const> const& archive,
+                                       ChildRange const& children,
+                                       CompiledPattern const& pattern,
+                                       bool recurse,
+                                       std::vector<BundleResource>& resources) const
+    {
+        for (auto i = children.begin; i != children.end; ++i)
         {
-            if (*names[i].rbegin() == '/' && recurse)
+            std::string_view const name = m_SortedEntries[m_DirChildren[i]].first;
+            int const index = m_SortedEntries[m_DirChildren[i]].second;
+
+            bool const isDir = name.back() == '/';
+            if (isDir && recurse)
             {
-                this->FindNodes(archive, path + names[i], filePattern, recurse, resources);
+                if (auto const* grandChildren = FindChildren(name))
+                {
+                    this->FindNodes(archive, *grandChildren, pattern, recurse, resources);
+                }
             }
-            if (this->Matches(names[i], filePattern))
+
+            // match against the name relative to its parent directory
+            auto const nameStart = name.find_last_of('/', name.size() - (isDir ? 2 : 1));
+            if (Matches(name.substr(nameStart == std::string_view::npos ? 0 : nameStart + 1), pattern))
             {
-                resources.push_back(BundleResource(indices[i], archive));
+                resources.push_back(BundleResource(index, archive));
             }
         }
     }
 
+    BundleResourceContainer::ChildRange const*
+    BundleResourceContainer::FindChildren(std::string_view dirPath) const
+    {
+        auto iter = m_DirIndex.find(dirPath);
+        return iter == m_DirIndex.end() ? nullptr : &iter->second;
+    }
+
     void
     BundleResourceContainer::InitMiniz() const
     {
@@ -243,6 +260,10 @@ namespace cppmicroservices
     void
     BundleResourceContainer::InitSortedEntries() const
     {
+        // The index only depends on the zip file, which does not change
+        // when the container is closed and opened again.
+        bool const buildIndex = m_SortedEntries.empty();
+
         mz_uint numFiles = mz_zip_reader_get_num_files(const_cast<mz_zip_archive*>(&m_ZipArchive));
         for (mz_uint fileIndex = 0; fileIndex < numFiles; ++fileIndex)
         {
@@ -250,32 +271,110 @@ namespace cppmicroservices
             if (mz_zip_reader_get_filename(&m_ZipArchive, fileIndex, fileName, MZ_ZIP_MAX_ARCHIVE_FILENAME_SIZE))
             {
                 std::string strFileName = fileName;
-                m_SortedEntries.insert(std::make_pair(strFileName, fileIndex));
                 std::size_t pos = strFileName.find_first_of('/');
                 if (pos != std::string::npos)
                 {
                     m_SortedToplevelDirs.insert(strFileName.substr(0, pos));
                 }
+                if (buildIndex && !strFileName.empty())
+                {
+                    m_SortedEntries.emplace_back(std::move(strFileName), fileIndex);
+                }
             }
         }
+
+        if (!buildIndex)
+        {
+            return;
+        }
+
+        // Sort by name; for duplicate names the first entry in the zip file wins.
+        std::stable_sort(m_SortedEntries.begin(),
+                         m_SortedEntries.end(),
+                         [](NameIndexPair const& p1, NameIndexPair const& p2) { return p1.first < p2.first; });
+        m_SortedEntries.erase(std::unique(m_SortedEntries.begin(),
+                                          m_SortedEntries.end(),
+                                          [](NameIndexPair const& p1, NameIndexPair const& p2)
+                                          { return p1.first == p2.first; }),
+                              m_SortedEntries.end());
+
+        // Pair each entry with its parent directory. Only directories which
+        // have an entry of their own get children, top-level entries have none.
+        std::vector<std::pair<std::string_view, uint32_t>> parents;
+        parents.reserve(m_SortedEntries.size());
+        for (uint32_t i = 0; i < m_SortedEntries.size(); ++i)
+        {
+            std::string_view const name = m_SortedEntries[i].first;
+            std::size_t const end = name.back() == '/' ? name.size() - 1 : name.size();
+            std::size_t const pos = end == 0 ? std::string_view::npos : name.find_last_of('/', end - 1);
+            if (pos != std::string_view::npos)
+            {
+                parents.emplace_back(name.substr(0, pos + 1), i);
+            }
+        }
+
+        // Group the children by parent, keeping them sorted by name within a group.
+        std::stable_sort(parents.begin(),
+                         parents.end(),
+                         [](auto const& p1, auto const& p2) { return p1.first < p2.first; });
+
+        m_DirChildren.reserve(parents.size());
+        for (std::size_t first = 0; first < parents.size();)
+        {
+            std::size_t last = first;
+            while (last < parents.size() && parents[last].first == parents[first].first)
+            {
+                ++last;
+            }
+
+            auto const parentEntry = std::lower_bound(m_SortedEntries.begin(),
+                                                      m_SortedEntries.end(),
+                                                      parents[first].first,
+                                                      [](NameIndexPair const& entry, std::string_view name)
+                                                      { return entry.first < name; });
+            if (parentEntry != m_SortedEntries.end() && parentEntry->first == parents[first].first)
+            {
+                ChildRange range { static_cast<uint32_t>(m_DirChildren.size()), 0 };
+                for (auto i = first; i < last; ++i)
+                {
+                    m_DirChildren.push_back(parents[i].second);
+                }
+                range.end = static_cast<uint32_t>(m_DirChildren.size());
+                m_DirIndex.emplace(std::string_view(parentEntry->first), range);
+            }
+            first = last;
+        }
     }
 
-    bool
-    BundleResourceContainer::Matches(std::string const& name, std::string const& filePattern) const
+    BundleResourceContainer::CompiledPattern
+    BundleResourceContainer::CompilePattern(std::string const& filePattern)
     {
-        // short-cut
-        if (filePattern == "*")
+        CompiledPattern pattern;
+        std::size_t pos = 0;
+        while (pos < filePattern.size())
         {
-            return true;
+            std::size_t next = filePattern.find('*', pos);
+            if (next == std::string::npos)
+            {
+                next = filePattern.size();
+            }
+            if (next > pos)
+            {
+                pattern.push_back(filePattern.substr(pos, next - pos));
+            }
+            pos = next + 1;
         }
+        return pattern;
+    }
 
-        std::stringstream ss(filePattern);
-        std::string tok;
+    bool
+    BundleResourceContainer::Matches(std::string_view name, CompiledPattern const& pattern)
+    {
         std::size_t pos = 0;
-        while (std::getline(ss, tok, '*'))
+        for (auto const& tok : pattern)
         {
             std::size_t index = name.find(tok, pos);
-            if (index == std::string::npos)
+            if (index == std::string_view::npos)
             {
                 return false;
             }
@@ -309,7 +408,7 @@ namespace cppmicroservices
     BundleResourceContainer::CloseContainer()
     {
         std::lock_guard<std::mutex> lock(m_ZipFileMutex);
-        if (m_IsContainerOpen)
+        if (m_IsContainerOpen && m_OpenReaders == 0)
         {
             mz_zip_reader_end(&m_ZipArchive);
             m_ObjFile.reset();
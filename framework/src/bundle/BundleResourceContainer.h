@@ -28,11 +28,14 @@
 
 #include "miniz.h"
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace cppmicroservices
@@ -55,8 +58,8 @@ namespace cppmicroservices
 
             std::string filePath;
             int index;
-            int compressedSize;
-            int uncompressedSize;
+            uint64_t compressedSize;
+            uint64_t uncompressedSize;
             time_t modifiedTime;
             uint32_t crc32;
             bool isDir;
@@ -85,24 +88,39 @@ namespace cppmicroservices
         /// Force close the file handle to the underlying zip file.
         /// This function should only be used as an optimization to
         /// control the number of open file handles on platforms
-        /// with a limit (e.g. Windows).
+        /// with a limit (e.g. Windows). The file stays open while
+        /// a BundleResourceReader for it exists.
         void CloseContainer();
 
       private:
+        friend class BundleResourceReader;
+
         using NameIndexPair = std::pair<std::string, int>;
 
-        struct PairComp
+        /// Range [begin, end) in m_DirChildren holding the children of one directory.
+        struct ChildRange
         {
-            inline bool
-            operator()(NameIndexPair const& p1, NameIndexPair const& p2) const
-            {
-                return p1.first < p2.first;
-            }
+            uint32_t begin;
+            uint32_t end;
         };
 
+        /// A file pattern split at its '*' wildcards, so that it is parsed
+        /// once and not for every name it is matched against.
+        using CompiledPattern = std::vector<std::string>;
+
         void InitSortedEntries() const;
 
-        bool Matches(std::string const& name, std::string const& filePattern) const;
+        static CompiledPattern CompilePattern(std::string const& filePattern);
+
+        static bool Matches(std::string_view name, CompiledPattern const& pattern);
+
+        ChildRange const* FindChildren(std::string_view dirPath) const;
+
+        void FindNodes(std::shared_ptr<BundleArchive const> const& archive,
+                       ChildRange const& children,
+                       CompiledPattern const& pattern,
+                       bool recurse,
+                       std::vector<BundleResource>& resources) const;
 
         /// Initialize miniz with the resource zip file information.
         /// throws std::runtime_error if the underlying zip file cannot be opened or read.
@@ -117,7 +135,14 @@ namespace cppmicroservices
         mutable mz_zip_archive m_ZipArchive;
         mutable std::unique_ptr<BundleObjFile> m_ObjFile;
 
-        mutable std::set<NameIndexPair, PairComp> m_SortedEntries;
+        // All entries sorted by name. Built once, never modified afterwards.
+        mutable std::vector<NameIndexPair> m_SortedEntries;
+        // Positions in m_SortedEntries of the children of each directory,
+        // grouped by directory and sorted by name within each group.
+        mutable std::vector<uint32_t> m_DirChildren;
+        // Directory entry name -> its children in m_DirChildren. The keys
+        // refer to the names stored in m_SortedEntries.
+        mutable std::unordered_map<std::string_view, ChildRange> m_DirIndex;
         mutable std::set<std::string> m_SortedToplevelDirs;
 
         // This is used to synchronize miniz file stream API calls.
@@ -129,6 +154,9 @@ namespace cppmicroservices
         // should open the underlying zip file.
         mutable std::mutex m_ZipFileMutex;
         mutable bool m_IsContainerOpen;
+
+        // Number of BundleResourceReader instances using m_ZipArchive.
+        std::atomic<int> m_OpenReaders;
     };
 } // namespace cppmicroservices
 
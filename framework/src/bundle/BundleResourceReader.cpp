@@ -0,0 +1,219 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#include "BundleResourceReader.h"
+#include "BundleResourceContainer.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace cppmicroservices
+{
+
+    namespace
+    {
+        // Layout of a zip local file header, see the zip APPNOTE
+        constexpr mz_uint32 LOCAL_HEADER_SIGNATURE = 0x04034b50;
+        constexpr std::size_t LOCAL_HEADER_SIZE = 30;
+        constexpr std::size_t LOCAL_HEADER_FILENAME_LEN_OFS = 26;
+        constexpr std::size_t LOCAL_HEADER_EXTRA_LEN_OFS = 28;
+
+        mz_uint32
+        ReadLittleEndian(unsigned char const* p, std::size_t bytes)
+        {
+            mz_uint32 value = 0;
+            for (std::size_t i = bytes; i > 0; --i)
+            {
+                value = (value << 8) | p[i - 1];
+            }
+            return value;
+        }
+    } // namespace
+
+    BundleResourceReader::BundleResourceReader(std::shared_ptr<BundleResourceContainer> container, int index)
+        : m_Container(std::move(container))
+        , m_Index(index)
+        , m_Size(0)
+        , m_DataOffset(0)
+        , m_Stored(false)
+        , m_Pos(0)
+        , m_State(nullptr)
+    {
+        // Registered before opening, so that the container is not closed
+        // underneath this reader. The destructor does not run if opening
+        // throws, so the registration is undone here.
+        ++m_Container->m_OpenReaders;
+        try
+        {
+            m_Container->OpenAndInitializeContainer();
+        }
+        catch (...)
+        {
+            --m_Container->m_OpenReaders;
+            throw;
+        }
+
+        mz_zip_archive_file_stat zipStat;
+        if (index >= 0 && mz_zip_reader_file_stat(&m_Container->m_ZipArchive, index, &zipStat))
+        {
+            m_Size = zipStat.m_uncomp_size;
+            if (zipStat.m_method == 0 && !zipStat.m_is_encrypted && zipStat.m_comp_size == m_Size)
+            {
+                std::lock_guard<std::mutex> l(m_Container->m_ZipFileStreamMutex);
+                m_Stored = LocateStoredData(zipStat.m_local_header_ofs);
+            }
+        }
+    }
+
+    BundleResourceReader::~BundleResourceReader()
+    {
+        {
+            std::lock_guard<std::mutex> l(m_Container->m_ZipFileStreamMutex);
+            CloseState();
+        }
+        --m_Container->m_OpenReaders;
+    }
+
+    uint64_t
+    BundleResourceReader::GetSize() const
+    {
+        return m_Size;
+    }
+
+    std::unique_ptr<void, void (*)(void*)>
+    BundleResourceReader::ReadAll()
+    {
+        return m_Container->GetData(m_Index);
+    }
+
+    std::size_t
+    BundleResourceReader::Read(char* buffer, std::size_t size)
+    {
+        std::lock_guard<std::mutex> l(m_Container->m_ZipFileStreamMutex);
+        if (m_Pos >= m_Size)
+        {
+            return 0;
+        }
+        if (m_Stored)
+        {
+            auto& archive = m_Container->m_ZipArchive;
+            auto const n = archive.m_pRead(archive.m_pIO_opaque,
+                                           m_DataOffset + m_Pos,
+                                           buffer,
+                                           static_cast<std::size_t>(std::min<uint64_t>(size, m_Size - m_Pos)));
+            m_Pos += n;
+            return n;
+        }
+        if (!OpenState())
+        {
+            return 0;
+        }
+        auto const n = mz_zip_reader_extract_iter_read(m_State, buffer, size);
+        m_Pos += n;
+        return n;
+    }
+
+    bool
+    BundleResourceReader::Seek(uint64_t pos)
+    {
+        if (pos > m_Size)
+        {
+            return false;
+        }
+
+        // stored data is read from its offset in the archive
+        if (m_Stored)
+        {
+            m_Pos = pos;
+            return true;
+        }
+
+        std::lock_guard<std::mutex> l(m_Container->m_ZipFileStreamMutex);
+        if (pos < m_Pos)
+        {
+            CloseState();
+            m_Pos = 0;
+        }
+        if (!OpenState())
+        {
+            return false;
+        }
+
+        std::vector<char> discard(static_cast<std::size_t>(std::min<uint64_t>(pos - m_Pos, 64 * 1024)));
+        while (m_Pos < pos)
+        {
+            auto const n = mz_zip_reader_extract_iter_read(
+                m_State,
+                discard.data(),
+                static_cast<std::size_t>(std::min<uint64_t>(pos - m_Pos, discard.size())));
+            if (n == 0)
+            {
+                return false;
+            }
+            m_Pos += n;
+        }
+        return true;
+    }
+
+    bool
+    BundleResourceReader::LocateStoredData(uint64_t localHeaderOffset)
+    {
+        auto& archive = m_Container->m_ZipArchive;
+        // offsets in the central directory are relative to the start of an
+        // archive appended to other data
+        auto const headerOffset = archive.m_archive_file_ofs + localHeaderOffset;
+        unsigned char header[LOCAL_HEADER_SIZE];
+        if (archive.m_pRead(archive.m_pIO_opaque, headerOffset, header, sizeof(header)) != sizeof(header)
+            || ReadLittleEndian(header, 4) != LOCAL_HEADER_SIGNATURE)
+        {
+            return false;
+        }
+
+        m_DataOffset = headerOffset + LOCAL_HEADER_SIZE
+                       + ReadLittleEndian(header + LOCAL_HEADER_FILENAME_LEN_OFS, 2)
+                       + ReadLittleEndian(header + LOCAL_HEADER_EXTRA_LEN_OFS, 2);
+        return m_DataOffset + m_Size <= archive.m_archive_size;
+    }
+
+    bool
+    BundleResourceReader::OpenState()
+    {
+        if (m_State == nullptr)
+        {
+            m_State = mz_zip_reader_extract_iter_new(&m_Container->m_ZipArchive, m_Index, 0);
+        }
+        return m_State != nullptr;
+    }
+
+    void
+    BundleResourceReader::CloseState()
+    {
+        if (m_State != nullptr)
+        {
+            // The iterator verifies size and CRC of the data read through it,
+            // which fails after a partial read or a seek. Nothing to report then.
+            mz_zip_reader_extract_iter_free(m_State);
+            m_State = nullptr;
+        }
+    }
+} // namespace cppmicroservices
@@ -0,0 +1,87 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#ifndef CPPMICROSERVICES_BUNDLERESOURCEREADER_H
+#define CPPMICROSERVICES_BUNDLERESOURCEREADER_H
+
+#include "miniz.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cppmicroservices
+{
+
+    class BundleResourceContainer;
+
+    /**
+     * Reads the data of one bundle resource incrementally. Compressed data is
+     * inflated in bounded chunks, so memory use does not depend on the size of
+     * the resource.
+     *
+     * While a reader exists, its BundleResourceContainer is kept open.
+     * A reader must not be used by more than one thread at a time.
+     */
+    class BundleResourceReader
+    {
+      public:
+        BundleResourceReader(std::shared_ptr<BundleResourceContainer> container, int index);
+        ~BundleResourceReader();
+
+        BundleResourceReader(BundleResourceReader const&) = delete;
+        BundleResourceReader& operator=(BundleResourceReader const&) = delete;
+
+        /// The uncompressed size of the resource.
+        uint64_t GetSize() const;
+
+        /// Extracts the whole resource in one go, ignoring the read position.
+        std::unique_ptr<void, void (*)(void*)> ReadAll();
+
+        /// Reads up to size bytes from the current position. Returns the number
+        /// of bytes read, which is 0 at the end of the data or on errors.
+        std::size_t Read(char* buffer, std::size_t size);
+
+        /// Moves the read position to pos. This takes constant time for stored
+        /// entries. Compressed entries are inflated up to pos, from the
+        /// beginning if pos lies before the current position.
+        bool Seek(uint64_t pos);
+
+      private:
+        // Must be called with the container's zip file stream mutex held.
+        bool LocateStoredData(uint64_t localHeaderOffset);
+        bool OpenState();
+        void CloseState();
+
+        std::shared_ptr<BundleResourceContainer> m_Container;
+        int const m_Index;
+        uint64_t m_Size;
+        // Archive offset of the data of a stored entry, which is read
+        // directly instead of through the extraction iterator.
+        uint64_t m_DataOffset;
+        bool m_Stored;
+        uint64_t m_Pos;
+        mz_zip_reader_extract_iter_state* m_State;
+    };
+} // namespace cppmicroservices
+
+#endif // CPPMICROSERVICES_BUNDLERESOURCEREADER_H
@@ -57,6 +57,12 @@ namespace cppmicroservices
         const std::string FRAMEWORK_WORKING_DIR = "org.cppmicroservices.framework.working.dir";
         const std::string FRAMEWORK_BUNDLE_VALIDATION_FUNC
             = "org.cppmicroservices.framework.bundle.validation.function";
+        const std::string FRAMEWORK_BUNDLE_LIBRARY_PRELOAD = "org.cppmicroservices.framework.bundle.library.preload";
+        const std::string FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_PREFETCH = "prefetch";
+        const std::string FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_LOAD = "load";
+        const std::string FRAMEWORK_BUNDLE_LAZY_ACTIVATION = "org.cppmicroservices.framework.bundle.lazy_activation";
+        const std::string FRAMEWORK_TRACE_FILE = "org.cppmicroservices.framework.trace.file";
+        const std::string FRAMEWORK_LOCK_PROFILING = "org.cppmicroservices.framework.lock.profiling";
         const std::string OBJECTCLASS = "objectclass";
         const std::string SERVICE_ID = "service.id";
         const std::string SERVICE_PID = "service.pid";
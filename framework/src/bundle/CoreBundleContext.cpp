@@ -29,6 +29,8 @@ US_MSVC_DISABLE_WARNING(4355)
 #include "cppmicroservices/BundleInitialization.h"
 #include "cppmicroservices/Constants.h"
 #include "cppmicroservices/FrameworkFactory.h"
+#include "cppmicroservices/LockProfiler.h"
+#include "cppmicroservices/detail/Trace.h"
 
 #include "cppmicroservices/util/FileSystem.h"
 #include "cppmicroservices/util/String.h"
@@ -37,6 +39,7 @@ US_MSVC_DISABLE_WARNING(4355)
 #include "BundleStorageMemory.h"
 #include "FrameworkPrivate.h"
 
+#include <fstream>
 #include <iomanip>
 #include <memory>
 
@@ -94,6 +97,9 @@ namespace cppmicroservices
         , firstInit(true)
         , initCount(0)
         , libraryLoadOptions(0)
+        , libraryPreload(LibraryPreload::NONE)
+        , lazyActivation(false)
+        , lockProfiling(false)
         , stopped(false)
     {
         auto enableDiagLog = any_cast<bool>(frameworkProperties.at(Constants::FRAMEWORK_LOG));
@@ -103,7 +109,17 @@ namespace cppmicroservices
         DIAG_LOG(*sink) << "created";
     }
 
-    CoreBundleContext::~CoreBundleContext() = default;
+    CoreBundleContext::~CoreBundleContext()
+    {
+        if (!traceFile.empty())
+        {
+            detail::Tracer::Disable();
+        }
+        if (lockProfiling)
+        {
+            LockProfiler::Disable();
+        }
+    }
 
     std::shared_ptr<CoreBundleContext>
     CoreBundleContext::shared_from_this() const
@@ -165,6 +181,69 @@ namespace cppmicroservices
                 = any_cast<std::function<bool(cppmicroservices::Bundle const&)>>(bundleValidationFunc->second);
         }
 
+        libraryPreload = LibraryPreload::NONE;
+        auto libraryPreloadProp = frameworkProperties.find(Constants::FRAMEWORK_BUNDLE_LIBRARY_PRELOAD);
+        if (libraryPreloadProp != frameworkProperties.end())
+        {
+            if (libraryPreloadProp->second == Constants::FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_LOAD)
+            {
+                // Never load a library before the validation function had a look at it.
+                libraryPreload = validationFunc ? LibraryPreload::PREFETCH : LibraryPreload::LOAD;
+            }
+            else if (libraryPreloadProp->second == Constants::FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_PREFETCH)
+            {
+                libraryPreload = LibraryPreload::PREFETCH;
+            }
+        }
+        DIAG_LOG(*sink) << "Bundle library preload = " << static_cast<int>(libraryPreload);
+
+        lazyActivation = false;
+        auto lazyActivationProp = frameworkProperties.find(Constants::FRAMEWORK_BUNDLE_LAZY_ACTIVATION);
+        if (lazyActivationProp != frameworkProperties.end())
+        {
+            try
+            {
+                lazyActivation = any_cast<bool>(lazyActivationProp->second);
+            }
+            catch (BadAnyCastException const&)
+            {
+                DIAG_LOG(*sink) << "Ignoring " << Constants::FRAMEWORK_BUNDLE_LAZY_ACTIVATION
+                                << ", expected a bool but found " << lazyActivationProp->second.Type().name();
+            }
+        }
+        DIAG_LOG(*sink) << "Bundle lazy activation = " << lazyActivation;
+
+        auto traceFileProp = frameworkProperties.find(Constants::FRAMEWORK_TRACE_FILE);
+        if (traceFile.empty() && traceFileProp != frameworkProperties.end()
+            && traceFileProp->second.Type() == typeid(std::string))
+        {
+            traceFile = any_cast<std::string>(traceFileProp->second);
+            if (!traceFile.empty())
+            {
+                detail::Tracer::Enable();
+                DIAG_LOG(*sink) << "Tracing startup to " << traceFile;
+            }
+        }
+
+        auto lockProfilingProp = frameworkProperties.find(Constants::FRAMEWORK_LOCK_PROFILING);
+        if (!lockProfiling && lockProfilingProp != frameworkProperties.end())
+        {
+            try
+            {
+                lockProfiling = any_cast<bool>(lockProfilingProp->second);
+            }
+            catch (BadAnyCastException const&)
+            {
+                DIAG_LOG(*sink) << "Ignoring " << Constants::FRAMEWORK_LOCK_PROFILING << ", expected a bool but found "
+                                << lockProfilingProp->second.Type().name();
+            }
+            if (lockProfiling)
+            {
+                LockProfiler::Enable();
+                DIAG_LOG(*sink) << "Lock profiling enabled";
+            }
+        }
+
         systemBundle->InitSystemBundle();
         US_SET_CTX_FUNC(system_bundle)(systemBundle->bundleContext.Load().get());
 
@@ -240,6 +319,24 @@ namespace cppmicroservices
         resolver.Clear();
 
         storage->Close();
+
+        if (!traceFile.empty())
+        {
+            std::ofstream traceStream(traceFile, std::ios_base::out | std::ios_base::trunc);
+            detail::Tracer::WriteChromeTrace(traceStream);
+            if (!traceStream)
+            {
+                DIAG_LOG(*sink) << "Failed to write the startup trace to " << traceFile;
+            }
+            detail::Tracer::Disable();
+            traceFile.clear();
+        }
+
+        if (lockProfiling)
+        {
+            LockProfiler::Disable();
+            lockProfiling = false;
+        }
     }
 
     std::string
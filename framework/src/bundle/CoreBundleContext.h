@@ -53,6 +53,7 @@ as specified in the OSGi R4.2 specifications.
 #include "ServiceHooks.h"
 #include "ServiceListeners.h"
 #include "ServiceRegistry.h"
+#include "WorkerPool.h"
 
 #include <map>
 #include <ostream>
@@ -183,6 +184,43 @@ namespace cppmicroservices
          */
         int libraryLoadOptions;
 
+        enum class LibraryPreload : uint8_t
+        {
+            NONE,
+            PREFETCH,
+            LOAD
+        };
+
+        /**
+         * How bundle shared libraries are preloaded after installation.
+         * See Constants::FRAMEWORK_BUNDLE_LIBRARY_PRELOAD.
+         */
+        LibraryPreload libraryPreload;
+
+        /**
+         * Runs the background preloads of bundle libraries, on at most
+         * std::thread::hardware_concurrency() threads.
+         */
+        WorkerPool libraryPreloadPool;
+
+        /**
+         * Whether bundles are always started according to their declared
+         * activation policy. See Constants::FRAMEWORK_BUNDLE_LAZY_ACTIVATION.
+         */
+        bool lazyActivation;
+
+        /**
+         * Path the startup trace is written to when the framework stops, empty
+         * if tracing is disabled. See Constants::FRAMEWORK_TRACE_FILE.
+         */
+        std::string traceFile;
+
+        /**
+         * Whether this framework enabled the LockProfiler. See
+         * Constants::FRAMEWORK_LOCK_PROFILING.
+         */
+        bool lockProfiling;
+
         std::function<bool(cppmicroservices::Bundle const&)> validationFunc;
 
         ~CoreBundleContext();
@@ -39,9 +39,21 @@
 namespace cppmicroservices
 {
 
-    ServiceHooks::ServiceHooks(CoreBundleContext* coreCtx) : coreCtx(coreCtx), listenerHookTracker(), bOpen(false) {}
+    namespace
+    {
+        detail::LockSite hooksLockSite("ServiceHooks");
+    } // namespace
+
+    ServiceHooks::ServiceHooks(CoreBundleContext* coreCtx) : coreCtx(coreCtx), listenerHookTracker(), bOpen(false)
+    {
+        SetLockSite(&hooksLockSite);
+    }
 
-    ServiceHooks::~ServiceHooks() { this->Close(); }
+    ServiceHooks::~ServiceHooks()
+    {
+        this->Close();
+        SetLockSite(nullptr);
+    }
 
     std::shared_ptr<ServiceListenerHook>
     ServiceHooks::AddingService(ServiceReference<ServiceListenerHook> const& reference)
@@ -113,15 +125,13 @@ namespace cppmicroservices
                                           std::string const& filter,
                                           std::vector<ServiceReferenceBase>& refs)
     {
-        std::vector<ServiceRegistrationBase> srl;
-        coreCtx->services.Get_unlocked(us_service_interface_iid<ServiceFindHook>(), srl);
-        if (!srl.empty())
+        auto srl = coreCtx->services.GetHooks(us_service_interface_iid<ServiceFindHook>());
+        if (srl)
         {
             ShrinkableVector<ServiceReferenceBase> filtered(refs);
 
             auto selfBundle = GetBundleContext().GetBundle();
-            std::sort(srl.begin(), srl.end());
-            for (auto fhrIter = srl.rbegin(), fhrEnd = srl.rend(); fhrIter != fhrEnd; ++fhrIter)
+            for (auto fhrIter = srl->begin(), fhrEnd = srl->end(); fhrIter != fhrEnd; ++fhrIter)
             {
                 ServiceReference<ServiceFindHook> sr = fhrIter->GetReference();
                 auto fh
@@ -150,11 +160,9 @@ namespace cppmicroservices
     ServiceHooks::FilterServiceEventReceivers(ServiceEvent const& evt,
                                               ServiceListeners::ServiceListenerEntries& receivers)
     {
-        std::vector<ServiceRegistrationBase> eventListenerHooks;
-        coreCtx->services.Get(us_service_interface_iid<ServiceEventListenerHook>(), eventListenerHooks);
-        if (!eventListenerHooks.empty())
+        auto eventListenerHooks = coreCtx->services.GetHooks(us_service_interface_iid<ServiceEventListenerHook>());
+        if (eventListenerHooks)
         {
-            std::sort(eventListenerHooks.begin(), eventListenerHooks.end());
             std::map<BundleContext, std::vector<ServiceListenerHook::ListenerInfo>> listeners;
             for (auto& sle : receivers)
             {
@@ -172,7 +180,7 @@ namespace cppmicroservices
                 shrinkableListeners);
 
             auto selfBundle = GetBundleContext().GetBundle();
-            for (auto sriIter = eventListenerHooks.rbegin(), sriEnd = eventListenerHooks.rend(); sriIter != sriEnd;
+            for (auto sriIter = eventListenerHooks->begin(), sriEnd = eventListenerHooks->end(); sriIter != sriEnd;
                  ++sriIter)
             {
                 ServiceReference<ServiceEventListenerHook> sr = sriIter->GetReference();
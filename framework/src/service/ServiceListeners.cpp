@@ -31,6 +31,7 @@ US_MSVC_PUSH_DISABLE_WARNING(4180) // qualifier applied to function type has no
 #include "cppmicroservices/ListenerFunctors.h"
 #include "cppmicroservices/SecurityException.h"
 #include "cppmicroservices/SharedLibraryException.h"
+#include "cppmicroservices/detail/Trace.h"
 #include "cppmicroservices/util/Error.h"
 #include "cppmicroservices/util/String.h"
 
@@ -47,16 +48,38 @@ US_MSVC_PUSH_DISABLE_WARNING(4180) // qualifier applied to function type has no
 namespace cppmicroservices
 {
 
+    namespace
+    {
+        detail::LockSite listenersLockSite("ServiceListeners");
+        detail::LockSite bundleListenersLockSite("ServiceListeners::bundleListenerMap");
+        detail::LockSite frameworkListenersLockSite("ServiceListeners::frameworkListenerMap");
+    } // namespace
+
     ServiceListeners::ServiceListeners(CoreBundleContext* coreCtx) : listenerId(0), coreCtx(coreCtx)
     {
+        SetLockSite(&listenersLockSite);
+        bundleListenerMap.SetLockSite(&bundleListenersLockSite);
+        frameworkListenerMap.SetLockSite(&frameworkListenersLockSite);
         hashedServiceKeys.push_back(Constants::OBJECTCLASS);
         hashedServiceKeys.push_back(Constants::SERVICE_ID);
     }
 
+    ServiceListeners::~ServiceListeners()
+    {
+        SetLockSite(nullptr);
+        bundleListenerMap.SetLockSite(nullptr);
+        frameworkListenerMap.SetLockSite(nullptr);
+    }
+
     void
     ServiceListeners::Clear()
     {
-        bundleListenerMap.Lock(), bundleListenerMap.value.clear();
+        {
+            auto l = bundleListenerMap.Lock();
+            US_UNUSED(l);
+            bundleListenerMap.value.clear();
+            bundleListenerMap.Invalidate_unlocked();
+        }
         {
             auto l = this->Lock();
             US_UNUSED(l);
@@ -67,7 +90,12 @@ namespace cppmicroservices
             cache[1].clear();
         }
 
-        frameworkListenerMap.Lock(), frameworkListenerMap.value.clear();
+        {
+            auto l = frameworkListenerMap.Lock();
+            US_UNUSED(l);
+            frameworkListenerMap.value.clear();
+            frameworkListenerMap.Invalidate_unlocked();
+        }
     }
 
     ListenerToken
@@ -171,6 +199,7 @@ namespace cppmicroservices
         US_UNUSED(l);
         auto& listeners = bundleListenerMap.value[context];
         listeners[token.Id()] = std::make_tuple(listener, data);
+        bundleListenerMap.Invalidate_unlocked();
         return token;
     }
 
@@ -203,6 +232,7 @@ namespace cppmicroservices
         if (it != listeners.end())
         {
             listeners.erase(it);
+            bundleListenerMap.Invalidate_unlocked();
         }
     }
 
@@ -217,6 +247,7 @@ namespace cppmicroservices
         US_UNUSED(l);
         auto& listeners = frameworkListenerMap.value[context];
         listeners[token.Id()] = std::make_tuple(listener, data);
+        frameworkListenerMap.Invalidate_unlocked();
         return token;
     }
 
@@ -249,6 +280,7 @@ namespace cppmicroservices
         if (it != listeners.end())
         {
             listeners.erase(it);
+            frameworkListenerMap.Invalidate_unlocked();
         }
     }
 
@@ -259,7 +291,12 @@ namespace cppmicroservices
         auto l = listenerMap.Lock();
         US_UNUSED(l);
         auto& listeners = listenerMap.value[context];
-        return (listeners.erase(tokenId) != 0);
+        if (listeners.erase(tokenId) == 0)
+        {
+            return false;
+        }
+        listenerMap.Invalidate_unlocked();
+        return true;
     }
 
     void
@@ -283,16 +320,11 @@ namespace cppmicroservices
     ServiceListeners::SendFrameworkEvent(FrameworkEvent const& evt)
     {
         // avoid deadlocks, race conditions and other undefined behavior
-        // by using a local snapshot of all listeners.
+        // by using a snapshot of all listeners.
         // A lock shouldn't be held while calling into user code (e.g. callbacks).
-        FrameworkListenerMap listener_snapshot;
-        {
-            auto l = frameworkListenerMap.Lock();
-            US_UNUSED(l);
-            listener_snapshot = frameworkListenerMap.value;
-        }
+        auto listener_snapshot = frameworkListenerMap.GetSnapshot();
 
-        for (auto& listeners : listener_snapshot)
+        for (auto& listeners : *listener_snapshot)
         {
             for (auto& listener : listeners.second)
             {
@@ -315,10 +347,9 @@ namespace cppmicroservices
     void
     ServiceListeners::BundleChanged(BundleEvent const& evt)
     {
-        BundleListenerMap filteredBundleListeners;
-        coreCtx->bundleHooks.FilterBundleEventReceivers(evt, filteredBundleListeners);
+        auto filteredBundleListeners = coreCtx->bundleHooks.FilterBundleEventReceivers(evt);
 
-        for (auto& bundleListeners : filteredBundleListeners)
+        for (auto& bundleListeners : *filteredBundleListeners)
         {
             for (auto& bundleListener : bundleListeners.second)
             {
@@ -378,12 +409,14 @@ namespace cppmicroservices
             auto l = bundleListenerMap.Lock();
             US_UNUSED(l);
             bundleListenerMap.value.erase(context);
+            bundleListenerMap.Invalidate_unlocked();
         }
 
         {
             auto l = frameworkListenerMap.Lock();
             US_UNUSED(l);
             frameworkListenerMap.value.erase(context);
+            frameworkListenerMap.Invalidate_unlocked();
         }
     }
 
@@ -417,6 +450,8 @@ namespace cppmicroservices
                                      ServiceEvent const& evt,
                                      ServiceListenerEntries& matchBefore)
     {
+        detail::TraceSpan span("framework", "ServiceChanged");
+
         if (!matchBefore.empty())
         {
             for (auto& l : receivers)
@@ -488,6 +523,42 @@ namespace cppmicroservices
         }
     }
 
+    void
+    ServiceListeners::GetMatchingServiceListeners(ServiceEvent const& evt,
+                                                  ServiceListenerEntries& set,
+                                                  std::vector<std::string> const& changedKeys)
+    {
+        ServiceListenerEntries receivers;
+        {
+            auto l = this->Lock();
+            US_UNUSED(l);
+            for (auto& sse : complicatedListeners)
+            {
+                if (sse.GetLDAPExpr().ReferencesAttribute(changedKeys, false))
+                {
+                    receivers.insert(sse);
+                }
+            }
+        }
+        if (receivers.empty())
+        {
+            return;
+        }
+
+        // This must not be called with any locks held
+        coreCtx->serviceHooks.FilterServiceEventReceivers(evt, receivers);
+
+        auto ref = evt.GetServiceReference();
+        auto props = ref.d.Load()->GetProperties();
+        for (auto& sse : receivers)
+        {
+            if (sse.GetLDAPExpr().Evaluate(props, false))
+            {
+                set.insert(sse);
+            }
+        }
+    }
+
     std::vector<ServiceListenerHook::ListenerInfo>
     ServiceListeners::GetListenerInfoCollection() const
     {
@@ -513,11 +584,15 @@ namespace cppmicroservices
                 std::vector<std::string>& filters = sle.GetLocalCache()[i];
                 for (auto const& filter : filters)
                 {
-                    std::set<ServiceListenerEntry>& sles = keymap[filter];
-                    sles.erase(sle);
-                    if (sles.empty())
+                    auto const sles = keymap.find(filter);
+                    if (sles == keymap.end())
+                    {
+                        continue;
+                    }
+                    sles->second.erase(sle);
+                    if (sles->second.empty())
                     {
-                        keymap.erase(filter);
+                        keymap.erase(sles);
                     }
                 }
             }
@@ -547,8 +622,12 @@ namespace cppmicroservices
                          it != local_cache[i].end();
                          ++it)
                     {
-                        std::set<ServiceListenerEntry>& sles = cache[i][*it];
-                        sles.insert(sle);
+                        auto sles = cache[i].find(*it);
+                        if (sles == cache[i].end())
+                        {
+                            sles = cache[i].emplace(*it, CacheType::mapped_type()).first;
+                        }
+                        sles->second.insert(sle);
                     }
                 }
             }
@@ -568,7 +647,7 @@ namespace cppmicroservices
         auto const cacheItr = cache[cache_ix].find(val);
         if (cacheItr != cache[cache_ix].end())
         {
-            std::set<ServiceListenerEntry>& l = cache[cache_ix][val];
+            std::set<ServiceListenerEntry> const& l = cacheItr->second;
             if (!l.empty())
             {
                 for (ServiceListenerEntry const& entry : l)
@@ -35,6 +35,7 @@
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace cppmicroservices
 {
@@ -54,10 +55,42 @@ namespace cppmicroservices
         using BundleListenerMap = std::unordered_map<std::shared_ptr<BundleContextPrivate>,
                                                      std::unordered_map<ListenerTokenId, BundleListenerEntry>>;
 
-        struct : public MultiThreaded<>
+        /**
+         * A listener map together with an immutable copy of it which is
+         * handed out to event delivery. The copy is shared by all events
+         * until the map changes, so delivering an event does not copy the
+         * listeners.
+         */
+        template <typename Map>
+        struct SnapshotListenerMap : public MultiThreaded<>
         {
-            BundleListenerMap value;
-        } bundleListenerMap;
+            Map value;
+            std::shared_ptr<Map const> snapshot;
+
+            /**
+             * Drop the current snapshot. Must be called with the lock held
+             * whenever <code>value</code> is modified.
+             */
+            void
+            Invalidate_unlocked()
+            {
+                snapshot.reset();
+            }
+
+            std::shared_ptr<Map const>
+            GetSnapshot()
+            {
+                auto l = this->Lock();
+                US_UNUSED(l);
+                if (!snapshot)
+                {
+                    snapshot = std::make_shared<Map const>(value);
+                }
+                return snapshot;
+            }
+        };
+
+        SnapshotListenerMap<BundleListenerMap> bundleListenerMap;
 
         using CacheType = std::unordered_map<std::string, std::set<ServiceListenerEntry>>;
         using ServiceListenerEntries = std::unordered_set<ServiceListenerEntry>;
@@ -69,10 +102,7 @@ namespace cppmicroservices
       private:
         std::atomic<uint64_t> listenerId;
 
-        struct : public MultiThreaded<>
-        {
-            FrameworkListenerMap value;
-        } frameworkListenerMap;
+        SnapshotListenerMap<FrameworkListenerMap> frameworkListenerMap;
 
         std::vector<std::string> hashedServiceKeys;
         static int const OBJECTCLASS_IX = 0;
@@ -90,6 +120,7 @@ namespace cppmicroservices
 
       public:
         ServiceListeners(CoreBundleContext* coreCtx);
+        ~ServiceListeners();
 
         void Clear();
 
@@ -216,6 +247,17 @@ namespace cppmicroservices
          */
         void GetMatchingServiceListeners(ServiceEvent const& evt, ServiceListenerEntries& listeners);
 
+        /**
+         * Get the listeners matching the service of <code>evt</code> whose
+         * filters compare one of <code>changedKeys</code>. These are the only
+         * listeners which may stop matching when the given properties change;
+         * listeners cached by object class or service id, and listeners
+         * without a filter, keep matching.
+         */
+        void GetMatchingServiceListeners(ServiceEvent const& evt,
+                                         ServiceListenerEntries& listeners,
+                                         std::vector<std::string> const& changedKeys);
+
         std::vector<ServiceListenerHook::ListenerInfo> GetListenerInfoCollection() const;
 
       private:
@@ -32,6 +32,7 @@
 #include "CoreBundleContext.h"
 #include "ServiceReferenceBasePrivate.h"
 
+#include <cstdint>
 #include <set>
 #include <utility>
 
@@ -50,17 +51,23 @@ namespace cppmicroservices
         {
         }
 
+        /**
+         * \param prototypeInstance Set to the handle releasing a prototype
+         *        scope service object, or 0 for other scopes.
+         */
         InterfaceMapConstPtr
-        GetServiceInterfaceMap()
+        GetServiceInterfaceMap(std::uint64_t& prototypeInstance)
         {
             InterfaceMapConstPtr result;
+            prototypeInstance = 0;
 
             bool isPrototypeScope
                 = m_reference.GetProperty(Constants::SERVICE_SCOPE).ToString() == Constants::SCOPE_PROTOTYPE;
 
             if (isPrototypeScope)
             {
-                result = m_reference.d.Load()->GetPrototypeService(MakeBundleContext(m_context).GetBundle());
+                result = m_reference.d.Load()->GetPrototypeService(MakeBundleContext(m_context).GetBundle(),
+                                                                   prototypeInstance);
             }
             else
             {
@@ -96,11 +103,19 @@ namespace cppmicroservices
         const InterfaceMapConstPtr interfaceMap;
         const ServiceReferenceBase sref;
         const std::weak_ptr<BundlePrivate> b;
-
-        UngetHelper(InterfaceMapConstPtr im, ServiceReferenceBase const& sr, std::shared_ptr<BundlePrivate> const& b)
+        const std::size_t useStripe;
+        const std::uint64_t prototypeInstance;
+
+        // Must be created on the thread which got the service.
+        UngetHelper(InterfaceMapConstPtr im,
+                    ServiceReferenceBase const& sr,
+                    std::shared_ptr<BundlePrivate> const& b,
+                    std::uint64_t prototypeInstance)
             : interfaceMap(std::move(im))
             , sref(sr)
             , b(b)
+            , useStripe(ServiceUseCounter::CurrentStripe())
+            , prototypeInstance(prototypeInstance)
         {
         }
         ~UngetHelper()
@@ -110,16 +125,13 @@ namespace cppmicroservices
                 auto bundle = b.lock();
                 if (sref)
                 {
-                    bool isPrototypeScope
-                        = sref.GetProperty(Constants::SERVICE_SCOPE).ToString() == Constants::SCOPE_PROTOTYPE;
-
-                    if (isPrototypeScope)
+                    if (prototypeInstance != 0)
                     {
-                        sref.d.Load()->UngetPrototypeService(bundle, interfaceMap);
+                        sref.d.Load()->UngetPrototypeService(bundle, prototypeInstance);
                     }
                     else
                     {
-                        sref.d.Load()->UngetService(bundle, true);
+                        sref.d.Load()->UngetService(bundle, true, useStripe);
                     }
                 }
             }
@@ -148,7 +160,8 @@ namespace cppmicroservices
             return nullptr;
         }
 
-        auto interfaceMap = d->GetServiceInterfaceMap();
+        std::uint64_t prototypeInstance = 0;
+        auto interfaceMap = d->GetServiceInterfaceMap(prototypeInstance);
         // interfaceMap can be null under certain circumstance e.g. if a constructor throws an
         // exception in the service implementation.  In that case, we bail out early.
         if (!interfaceMap)
@@ -162,7 +175,7 @@ namespace cppmicroservices
             return nullptr;
         }
 
-        auto h = std::make_shared<UngetHelper>(interfaceMap, d->m_reference, bundle_);
+        auto h = std::make_shared<UngetHelper>(interfaceMap, d->m_reference, bundle_, prototypeInstance);
         auto deleter = h->interfaceMap->find(d->m_reference.GetInterfaceId())->second.get();
         return std::shared_ptr<void>(h, deleter);
     }
@@ -176,7 +189,8 @@ namespace cppmicroservices
             return result;
         }
         // copy construct a new map to be handed out to consumers
-        auto interfaceMap = d->GetServiceInterfaceMap();
+        std::uint64_t prototypeInstance = 0;
+        auto interfaceMap = d->GetServiceInterfaceMap(prototypeInstance);
         // There are some circumstances that will cause the interfaceMap to be empty
         // like when another thread has unregistered the service.
         if (!interfaceMap)
@@ -191,7 +205,7 @@ namespace cppmicroservices
             return nullptr;
         }
 
-        std::shared_ptr<UngetHelper> h(new UngetHelper { result, d->m_reference, bundle_ });
+        std::shared_ptr<UngetHelper> h(new UngetHelper { result, d->m_reference, bundle_, prototypeInstance });
         return InterfaceMapConstPtr(h, h->interfaceMap.get());
     }
 
@@ -119,6 +119,10 @@ namespace cppmicroservices
         {
             bundles.push_back(MakeBundle(iter.first->shared_from_this()));
         }
+        for (auto const user : refP->coreInfo->singletonUses.GetUsers())
+        {
+            bundles.push_back(MakeBundle(user->shared_from_this()));
+        }
         return bundles;
     }
 
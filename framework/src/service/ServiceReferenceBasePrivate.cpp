@@ -65,6 +65,12 @@ namespace cppmicroservices
                                                        std::shared_ptr<ServiceFactory> const& factory)
     {
         assert(factory && "Factory service pointer is nullptr");
+        // The first service object retrieved from a lazily started bundle
+        // triggers its activation.
+        if (auto owner = coreInfo->bundle_.lock())
+        {
+            owner->ActivateLazily();
+        }
         try
         {
             InterfaceMapConstPtr smap = factory->GetService(MakeBundle(bundle->shared_from_this()),
@@ -144,19 +150,47 @@ namespace cppmicroservices
     }
 
     InterfaceMapConstPtr
-    ServiceReferenceBasePrivate::GetPrototypeService(Bundle const& bundle)
+    ServiceReferenceBasePrivate::GetPrototypeService(Bundle const& bundle, std::uint64_t& instance)
     {
         InterfaceMapConstPtr s;
+        instance = 0;
+        auto reg = registration.lock();
+        if (!coreInfo->available || !reg)
         {
-            auto reg = registration.lock();
-            if (coreInfo->available && reg)
+            return s;
+        }
+
+        auto const b = GetPrivate(bundle).get();
+        if (coreInfo->prototypePoolCapacity > 0)
+        {
+            auto l = LockServiceRegistration();
+            US_UNUSED(l);
+            auto poolIter = coreInfo->prototypeServicePool.find(b);
+            if (poolIter != coreInfo->prototypeServicePool.end())
             {
-                auto factory
-                    = std::static_pointer_cast<ServiceFactory>(reg->GetService("org.cppmicroservices.factory"));
-                s = GetServiceFromFactory(GetPrivate(bundle).get(), factory);
-                LockServiceRegistration(), coreInfo->prototypeServiceInstances[GetPrivate(bundle).get()].push_back(s);
+                s = std::move(poolIter->second.back());
+                poolIter->second.pop_back();
+                if (poolIter->second.empty())
+                {
+                    coreInfo->prototypeServicePool.erase(poolIter);
+                }
             }
         }
+
+        if (!s)
+        {
+            auto factory = std::static_pointer_cast<ServiceFactory>(reg->GetService("org.cppmicroservices.factory"));
+            s = GetServiceFromFactory(b, factory);
+        }
+
+        if (s)
+        {
+            auto l = LockServiceRegistration();
+            US_UNUSED(l);
+            instance = coreInfo->nextPrototypeInstance++;
+            coreInfo->prototypeServiceInstances.emplace(instance, ServiceRegistrationCoreInfo::PrototypeInstance { b, s });
+            ++coreInfo->prototypeServiceUsers[b];
+        }
         return s;
     }
 
@@ -189,6 +223,25 @@ namespace cppmicroservices
         {
             return s;
         }
+
+        // Singleton scope services are handed out without taking the
+        // registration lock; only the calling thread's use count stripe is locked.
+        if (coreInfo->singleton)
+        {
+            auto const stripe = ServiceUseCounter::CurrentStripe();
+            auto l = coreInfo->singletonUses.LockStripe(stripe);
+            US_UNUSED(l);
+            if (coreInfo->available)
+            {
+                s = coreInfo->service;
+                if (s && !s->empty())
+                {
+                    coreInfo->singletonUses.Acquire_unlocked(bundle, stripe);
+                }
+            }
+            return s;
+        }
+
         std::shared_ptr<ServiceFactory> serviceFactory;
 
         std::unordered_set<ServiceRegistrationBasePrivate*>* marks = nullptr;
@@ -221,21 +274,14 @@ namespace cppmicroservices
             }
             serviceFactory
                 = std::static_pointer_cast<ServiceFactory>(reg->GetService_unlocked("org.cppmicroservices.factory"));
-
-            auto res = coreInfo->dependents.insert(std::make_pair(bundle, 0));
-            auto& depCounter = res.first->second;
-
-            // No service factory, just return the registered service directly.
             if (!serviceFactory)
             {
-                s = coreInfo->service;
-                if (s && !s->empty())
-                {
-                    ++depCounter;
-                }
                 return s;
             }
 
+            auto res = coreInfo->dependents.insert(std::make_pair(bundle, 0));
+            auto& depCounter = res.first->second;
+
             auto serviceIter = coreInfo->bundleServiceInstance.find(bundle);
             if (coreInfo->bundleServiceInstance.end() != serviceIter)
             {
@@ -306,81 +352,131 @@ namespace cppmicroservices
 
     bool
     ServiceReferenceBasePrivate::UngetPrototypeService(std::shared_ptr<BundlePrivate> const& bundle,
-                                                       InterfaceMapConstPtr const& service)
+                                                       std::uint64_t instance)
     {
-        std::list<InterfaceMapConstPtr> prototypeServiceMaps;
+        InterfaceMapConstPtr service;
         std::shared_ptr<ServiceFactory> sf;
+        auto reg = registration.lock();
+        if (!reg)
+        {
+            return false;
+        }
 
         {
-            auto reg = registration.lock();
             auto l = LockServiceRegistration();
             US_UNUSED(l);
-            auto iter = coreInfo->prototypeServiceInstances.find(bundle.get());
+            auto iter = coreInfo->prototypeServiceInstances.find(instance);
             if (iter == coreInfo->prototypeServiceInstances.end())
             {
                 return false;
             }
 
-            prototypeServiceMaps = iter->second;
+            auto const b = iter->second.bundle;
+            service = std::move(iter->second.service);
+            coreInfo->prototypeServiceInstances.erase(iter);
+            auto usersIter = coreInfo->prototypeServiceUsers.find(b);
+            if (usersIter != coreInfo->prototypeServiceUsers.end() && --usersIter->second == 0)
+            {
+                coreInfo->prototypeServiceUsers.erase(usersIter);
+            }
+
+            if (coreInfo->available && coreInfo->prototypePoolCapacity > 0)
+            {
+                auto& pool = coreInfo->prototypeServicePool[b];
+                if (pool.size() < coreInfo->prototypePoolCapacity)
+                {
+                    pool.push_back(std::move(service));
+                    return true;
+                }
+            }
+
             sf = std::static_pointer_cast<ServiceFactory>(reg->GetService_unlocked("org.cppmicroservices.factory"));
         }
 
-        if (!sf)
+        if (sf)
         {
-            return false;
+            UngetServiceFromFactory(*sf, bundle, service);
         }
+        return true;
+    }
 
-        for (auto& prototypeServiceMap : prototypeServiceMaps)
+    void
+    ServiceReferenceBasePrivate::UngetServiceFromFactory(ServiceFactory& sf,
+                                                         std::shared_ptr<BundlePrivate> const& bundle,
+                                                         InterfaceMapConstPtr const& service)
+    {
+        try
         {
-            // compare the contents of the map
-            if (*service.get() == *prototypeServiceMap.get())
+            sf.UngetService(MakeBundle(bundle), ServiceRegistrationBase(registration.lock()), service);
+        }
+        catch (std::exception const& ex)
+        {
+            if (auto bundle_ = coreInfo->bundle_.lock())
             {
-                try
-                {
-                    sf->UngetService(MakeBundle(bundle), ServiceRegistrationBase(registration.lock()), service);
-                }
-                catch (std::exception const& ex)
-                {
-                    if (auto bundle_ = coreInfo->bundle_.lock())
-                    {
-                        std::string message("ServiceFactory threw an exception");
-                        bundle_->coreCtx->listeners.SendFrameworkEvent(FrameworkEvent(
-                            FrameworkEvent::Type::FRAMEWORK_ERROR,
-                            MakeBundle(bundle->shared_from_this()),
-                            message,
-                            std::make_exception_ptr(
-                                ServiceException(ex.what(), ServiceException::Type::FACTORY_EXCEPTION))));
-                    }
-                }
-
-                auto l = LockServiceRegistration();
-                US_UNUSED(l);
-                auto iter = coreInfo->prototypeServiceInstances.find(bundle.get());
-                if (iter == coreInfo->prototypeServiceInstances.end())
-                {
-                    return true;
-                }
+                std::string message("ServiceFactory threw an exception");
+                bundle_->coreCtx->listeners.SendFrameworkEvent(
+                    FrameworkEvent(FrameworkEvent::Type::FRAMEWORK_ERROR,
+                                   MakeBundle(bundle->shared_from_this()),
+                                   message,
+                                   std::make_exception_ptr(
+                                       ServiceException(ex.what(), ServiceException::Type::FACTORY_EXCEPTION))));
+            }
+        }
+    }
 
-                auto serviceIter = std::find(iter->second.begin(), iter->second.end(), service);
-                if (serviceIter != iter->second.end())
-                {
-                    iter->second.erase(serviceIter);
-                }
-                if (iter->second.empty())
-                {
-                    coreInfo->prototypeServiceInstances.erase(iter);
-                }
-                return true;
+    void
+    ServiceReferenceBasePrivate::ReleasePrototypePool(std::shared_ptr<BundlePrivate> const& bundle)
+    {
+        std::vector<InterfaceMapConstPtr> pooled;
+        std::shared_ptr<ServiceFactory> sf;
+        {
+            auto reg = registration.lock();
+            auto l = LockServiceRegistration();
+            US_UNUSED(l);
+            auto poolIter = coreInfo->prototypeServicePool.find(bundle.get());
+            if (poolIter == coreInfo->prototypeServicePool.end() || !reg)
+            {
+                return;
             }
+            pooled = std::move(poolIter->second);
+            coreInfo->prototypeServicePool.erase(poolIter);
+            sf = std::static_pointer_cast<ServiceFactory>(reg->GetService_unlocked("org.cppmicroservices.factory"));
         }
 
-        return false;
+        if (sf)
+        {
+            for (auto const& service : pooled)
+            {
+                UngetServiceFromFactory(*sf, bundle, service);
+            }
+        }
     }
 
-    bool
-    ServiceReferenceBasePrivate::UngetService(std::shared_ptr<BundlePrivate> const& bundle, bool checkRefCounter)
+    void
+    ServiceReferenceBasePrivate::UngetService(std::shared_ptr<BundlePrivate> const& bundle,
+                                              bool checkRefCounter,
+                                              std::size_t useStripe)
     {
-        bool hadReferences = false;
+        if (coreInfo->singleton)
+        {
+            if (checkRefCounter)
+            {
+                coreInfo->singletonUses.Release(bundle.get(), useStripe);
+            }
+            else
+            {
+                coreInfo->singletonUses.Remove(bundle.get());
+            }
+            return;
+        }
+
+        if (!checkRefCounter)
+        {
+            // The bundle is going away, its pooled prototype service objects
+            // are of no further use.
+            ReleasePrototypePool(bundle);
+        }
+
         bool removeService = false;
         InterfaceMapConstPtr sfi;
         std::shared_ptr<ServiceFactory> sf;
@@ -392,15 +488,10 @@ namespace cppmicroservices
             auto depIter = coreInfo->dependents.find(bundle.get());
             if (coreInfo->dependents.end() == depIter)
             {
-                return hadReferences && removeService;
+                return;
             }
 
             int& count = depIter->second;
-            if (count > 0)
-            {
-                hadReferences = true;
-            }
-
             if (checkRefCounter)
             {
                 if (count > 1)
@@ -458,8 +549,6 @@ namespace cppmicroservices
                 }
             }
         }
-
-        return hadReferences && removeService;
     }
 
     PropertiesHandle
@@ -30,6 +30,7 @@
 #include "ServiceRegistrationLocks.h"
 
 #include <atomic>
+#include <cstdint>
 #include <string>
 
 namespace cppmicroservices
@@ -68,12 +69,15 @@ namespace cppmicroservices
         InterfaceMapConstPtr GetServiceInterfaceMap(BundlePrivate* bundle);
 
         /**
-         * Get new service instance.
+         * Get new service instance, or a pooled one if the factory keeps
+         * an instance pool.
          *
          * @param bundle requester of service.
+         * @param instance Set to the handle which releases the service object
+         *                 again, or 0 in case of failure.
          * @return Service requested or null in case of failure.
          */
-        InterfaceMapConstPtr GetPrototypeService(Bundle const& bundle);
+        InterfaceMapConstPtr GetPrototypeService(Bundle const& bundle, std::uint64_t& instance);
 
         /**
          * Unget the service object.
@@ -82,19 +86,20 @@ namespace cppmicroservices
          * @param checkRefCounter If true decrement refence counter and remove service
          *                        if we reach zero. If false remove service without
          *                        checking refence counter.
-         * @return True if service was removed or false if only reference counter was
-         *         decremented.
+         * @param useStripe The ServiceUseCounter::CurrentStripe() of the thread
+         *                  which got the service. Only used if \c checkRefCounter
+         *                  is true.
          */
-        bool UngetService(std::shared_ptr<BundlePrivate> const& bundle, bool checkRefCounter);
+        void UngetService(std::shared_ptr<BundlePrivate> const& bundle, bool checkRefCounter, std::size_t useStripe);
 
         /**
          * Unget prototype scope service objects.
          *
          * @param bundle Bundle who wants to remove a prototype scope service.
-         * @param service The prototype scope service pointer.
+         * @param instance The handle returned by GetPrototypeService.
          * @return \c true if the service was removed, \c false otherwise.
          */
-        bool UngetPrototypeService(std::shared_ptr<BundlePrivate> const& bundle, InterfaceMapConstPtr const& service);
+        bool UngetPrototypeService(std::shared_ptr<BundlePrivate> const& bundle, std::uint64_t instance);
 
         /**
          * Get a handle to the locked service properties.
@@ -123,6 +128,18 @@ namespace cppmicroservices
       private:
         InterfaceMapConstPtr GetServiceFromFactory(BundlePrivate* bundle,
                                                    std::shared_ptr<ServiceFactory> const& factory);
+
+        /**
+         * Call \c sf.UngetService, reporting exceptions as framework events.
+         */
+        void UngetServiceFromFactory(ServiceFactory& sf,
+                                     std::shared_ptr<BundlePrivate> const& bundle,
+                                     InterfaceMapConstPtr const& service);
+
+        /**
+         * Unget the prototype service objects pooled for \c bundle.
+         */
+        void ReleasePrototypePool(std::shared_ptr<BundlePrivate> const& bundle);
     };
 } // namespace cppmicroservices
 
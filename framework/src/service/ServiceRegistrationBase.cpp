@@ -34,6 +34,7 @@
 #include "ServiceRegistry.h"
 
 #include <stdexcept>
+#include <unordered_set>
 
 US_MSVC_DISABLE_WARNING(4503) // decorated name length exceeded, name was truncated
 
@@ -199,6 +200,150 @@ namespace cppmicroservices
         }
     }
 
+    void
+    ServiceRegistrationBase::UpdateProperties(ServiceProperties const& changes,
+                                              std::vector<std::string> const& removals)
+    {
+        if (!d)
+        {
+            throw std::logic_error("ServiceRegistrationBase object invalid");
+        }
+
+        // Collect the keys which may change, ignoring the ones owned by the framework.
+        std::vector<std::string> changedKeys;
+        std::unordered_set<std::string, detail::any_map_cihash, detail::any_map_ciequal> changeKeys;
+        bool rankingChanged = false;
+        int new_rank = 0;
+        auto isFrameworkKey = [](std::string const& key)
+        {
+            detail::any_map_ciequal const equal;
+            return equal(key, Constants::OBJECTCLASS) || equal(key, Constants::SERVICE_ID)
+                   || equal(key, Constants::SERVICE_SCOPE);
+        };
+        for (auto const& change : changes)
+        {
+            if (!changeKeys.insert(change.first).second)
+            {
+                throw std::invalid_argument("Properties contain case variants of the key: " + change.first);
+            }
+            if (isFrameworkKey(change.first))
+            {
+                continue;
+            }
+            if (detail::any_map_ciequal()(change.first, Constants::SERVICE_RANKING))
+            {
+                try
+                {
+                    new_rank = any_cast<int>(change.second);
+                }
+                catch (BadAnyCastException const& ex)
+                {
+                    std::string exMsg("SERVICE_RANKING property has unexpected value type. ");
+                    exMsg.append(ex.what());
+                    throw std::invalid_argument(exMsg);
+                }
+                rankingChanged = true;
+            }
+            changedKeys.push_back(change.first);
+        }
+        for (auto const& key : removals)
+        {
+            if (isFrameworkKey(key))
+            {
+                continue;
+            }
+            if (changeKeys.count(key) == 0 && detail::any_map_ciequal()(key, Constants::SERVICE_RANKING))
+            {
+                rankingChanged = true;
+            }
+            changedKeys.push_back(key);
+        }
+        if (changedKeys.empty())
+        {
+            return;
+        }
+
+        ServiceEvent modifiedEndMatchEvent;
+        ServiceEvent modifiedEvent;
+
+        ServiceListeners::ServiceListenerEntries before;
+
+        {
+            auto l = LockServiceRegistration();
+            US_UNUSED(l);
+            if (!d->coreInfo->available)
+            {
+                throw std::logic_error("Service is unregistered");
+            }
+            modifiedEndMatchEvent = ServiceEvent(ServiceEvent::SERVICE_MODIFIED_ENDMATCH, d->reference);
+            modifiedEvent = ServiceEvent(ServiceEvent::SERVICE_MODIFIED, d->reference);
+        }
+
+        // Only listeners comparing a changed key can stop matching. This calls
+        // into service event listener hooks. We must not hold any locks here
+        if (auto bundle = d->coreInfo->bundle_.lock())
+        {
+            bundle->coreCtx->listeners.GetMatchingServiceListeners(modifiedEndMatchEvent, before, changedKeys);
+        }
+
+        int old_rank = 0;
+        Any objectClasses;
+        {
+            auto l = LockServiceRegistration();
+            US_UNUSED(l);
+            if (!d->coreInfo->available)
+            {
+                throw std::logic_error("Service is unregistered");
+            }
+
+            auto l2 = d->coreInfo->properties.Lock();
+            US_UNUSED(l2);
+
+            auto& properties = d->coreInfo->properties;
+            if (rankingChanged)
+            {
+                objectClasses = properties.Value_unlocked(Constants::OBJECTCLASS).first;
+                auto oldRankAny = properties.Value_unlocked(Constants::SERVICE_RANKING).first;
+                if (!oldRankAny.Empty())
+                {
+                    old_rank = any_cast<int>(oldRankAny);
+                }
+            }
+
+            for (auto const& key : removals)
+            {
+                if (changeKeys.count(key) == 0 && !isFrameworkKey(key))
+                {
+                    properties.Remove_unlocked(key);
+                }
+            }
+            for (auto const& change : changes)
+            {
+                if (!isFrameworkKey(change.first))
+                {
+                    properties.Set_unlocked(change.first, change.second);
+                }
+            }
+        }
+        if (rankingChanged && old_rank != new_rank)
+        {
+            auto const& classes = ref_any_cast<std::vector<std::string>>(objectClasses);
+            if (auto bundle = d->coreInfo->bundle_.lock())
+            {
+                bundle->coreCtx->services.UpdateServiceRegistrationOrder(classes);
+            }
+        }
+
+        // Notify listeners, we must not hold any locks here
+        ServiceListeners::ServiceListenerEntries matchingListeners;
+        if (auto bundle = d->coreInfo->bundle_.lock())
+        {
+            bundle->coreCtx->listeners.GetMatchingServiceListeners(modifiedEvent, matchingListeners);
+            bundle->coreCtx->listeners.ServiceChanged(matchingListeners, modifiedEvent, before);
+            bundle->coreCtx->listeners.ServiceChanged(before, modifiedEndMatchEvent);
+        }
+    }
+
     void
     ServiceRegistrationBase::Unregister()
     {
@@ -247,7 +392,8 @@ namespace cppmicroservices
         }
 
         std::shared_ptr<ServiceFactory> serviceFactory;
-        ServiceRegistrationBasePrivate::BundleToServicesMap prototypeServiceInstances;
+        ServiceRegistrationCoreInfo::PrototypeInstanceMap prototypeServiceInstances;
+        ServiceRegistrationBasePrivate::BundleToServicesMap prototypeServicePool;
         ServiceRegistrationBasePrivate::BundleToServiceMap bundleServiceInstance;
 
         {
@@ -265,14 +411,19 @@ namespace cppmicroservices
             if (serviceFactory)
             {
                 prototypeServiceInstances = d->coreInfo->prototypeServiceInstances;
+                prototypeServicePool = d->coreInfo->prototypeServicePool;
                 bundleServiceInstance = d->coreInfo->bundleServiceInstance;
             }
         }
 
         if (serviceFactory)
         {
-            // unget all prototype services
+            // unget all prototype services, including pooled ones
             for (auto const& i : prototypeServiceInstances)
+            {
+                prototypeServicePool[i.second.bundle].push_back(i.second.service);
+            }
+            for (auto const& i : prototypeServicePool)
             {
                 for (auto const& service : i.second)
                 {
@@ -322,11 +473,16 @@ namespace cppmicroservices
         {
             auto l = LockServiceRegistration();
             US_UNUSED(l);
+            auto useLocks = d->coreInfo->singletonUses.LockAll();
+            US_UNUSED(useLocks);
 
             d->coreInfo->bundle_.reset();
             d->coreInfo->dependents.clear();
+            d->coreInfo->singletonUses.Clear_unlocked();
             d->coreInfo->service.reset();
             d->coreInfo->prototypeServiceInstances.clear();
+            d->coreInfo->prototypeServiceUsers.clear();
+            d->coreInfo->prototypeServicePool.clear();
             d->coreInfo->bundleServiceInstance.clear();
 
             d->reference = nullptr;
@@ -57,7 +57,9 @@ namespace cppmicroservices
         auto l1 = coreInfo->Lock();
         US_UNUSED(l1);
         return (coreInfo->dependents.find(bundle) != coreInfo->dependents.end())
-               || (coreInfo->prototypeServiceInstances.find(bundle) != coreInfo->prototypeServiceInstances.end());
+               || (coreInfo->prototypeServiceUsers.find(bundle) != coreInfo->prototypeServiceUsers.end())
+               || (coreInfo->prototypeServicePool.find(bundle) != coreInfo->prototypeServicePool.end())
+               || coreInfo->singletonUses.IsUsedBy(bundle);
     }
 
     InterfaceMapConstPtr
@@ -52,7 +52,7 @@ namespace cppmicroservices
       public:
         using BundleToRefsMap = std::unordered_map<BundlePrivate*, int>;
         using BundleToServiceMap = std::unordered_map<BundlePrivate*, InterfaceMapConstPtr>;
-        using BundleToServicesMap = std::unordered_map<BundlePrivate*, std::list<InterfaceMapConstPtr>>;
+        using BundleToServicesMap = std::unordered_map<BundlePrivate*, std::vector<InterfaceMapConstPtr>>;
 
         ServiceRegistrationBasePrivate(ServiceRegistrationBasePrivate const&) = delete;
         ServiceRegistrationBasePrivate& operator=(ServiceRegistrationBasePrivate const&) = delete;
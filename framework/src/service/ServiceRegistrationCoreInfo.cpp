@@ -22,6 +22,9 @@
 
 #include "ServiceRegistrationCoreInfo.h"
 
+#include "cppmicroservices/PrototypeServiceFactory.h"
+#include "cppmicroservices/PrototypeServiceInstancePool.h"
+
 #ifdef _MSC_VER
 #    pragma warning(push)
 #    pragma warning(disable : 4355)
@@ -30,14 +33,38 @@
 namespace cppmicroservices
 {
 
+    namespace
+    {
+        std::size_t
+        GetPrototypePoolCapacity(InterfaceMapConstPtr const& service)
+        {
+            if (!service)
+            {
+                return 0;
+            }
+            auto const factory = service->find("org.cppmicroservices.factory");
+            if (factory == service->end())
+            {
+                return 0;
+            }
+            auto const prototypeFactory
+                = dynamic_cast<PrototypeServiceFactory*>(static_cast<ServiceFactory*>(factory->second.get()));
+            auto const pool = dynamic_cast<PrototypeServiceInstancePool*>(prototypeFactory);
+            return pool ? pool->GetInstancePoolCapacity() : 0;
+        }
+    } // namespace
+
     ServiceRegistrationCoreInfo::ServiceRegistrationCoreInfo(BundlePrivate* bundle,
                                                              InterfaceMapConstPtr service,
                                                              Properties&& props)
         : service(std::move(service))
+        , nextPrototypeInstance(1)
+        , prototypePoolCapacity(GetPrototypePoolCapacity(this->service))
         , bundle_(bundle->shared_from_this())
         , properties(std::move(props))
         , available(true)
         , unregistering(false)
+        , singleton(this->service && this->service->find("org.cppmicroservices.factory") == this->service->end())
     {
     }
 } // namespace cppmicroservices
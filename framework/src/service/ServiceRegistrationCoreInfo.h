@@ -29,8 +29,12 @@
 
 #include "BundlePrivate.h"
 #include "Properties.h"
+#include "ServiceUseCounter.h"
 
 #include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 namespace cppmicroservices
 {
@@ -53,7 +57,25 @@ namespace cppmicroservices
 
         using BundleToRefsMap = std::unordered_map<BundlePrivate*, int>;
         using BundleToServiceMap = std::unordered_map<BundlePrivate*, InterfaceMapConstPtr>;
-        using BundleToServicesMap = std::unordered_map<BundlePrivate*, std::list<InterfaceMapConstPtr>>;
+        using BundleToServicesMap = std::unordered_map<BundlePrivate*, std::vector<InterfaceMapConstPtr>>;
+
+        /**
+         * A service object produced by a prototype factory and the bundle it
+         * was produced for.
+         */
+        struct PrototypeInstance
+        {
+            BundlePrivate* bundle;
+            InterfaceMapConstPtr service;
+        };
+
+        /**
+         * Prototype service objects in use, keyed by the handle returned
+         * from ServiceReferenceBasePrivate::GetPrototypeService. Handles are
+         * never reused, so releasing an object after the service was
+         * unregistered finds nothing.
+         */
+        using PrototypeInstanceMap = std::unordered_map<std::uint64_t, PrototypeInstance>;
 
         /**
          * Service or ServiceFactory object.
@@ -68,7 +90,29 @@ namespace cppmicroservices
         /**
          * Object instances that a prototype factory has produced.
          */
-        BundleToServicesMap prototypeServiceInstances;
+        PrototypeInstanceMap prototypeServiceInstances;
+
+        /**
+         * Number of entries in prototypeServiceInstances per bundle.
+         */
+        BundleToRefsMap prototypeServiceUsers;
+
+        /**
+         * Handle of the next prototype service object.
+         */
+        std::uint64_t nextPrototypeInstance;
+
+        /**
+         * Released prototype service objects kept for reuse, per bundle. Only
+         * used if the factory has an instance pool (see
+         * PrototypeServiceInstancePool).
+         */
+        BundleToServicesMap prototypeServicePool;
+
+        /**
+         * Maximum number of pooled prototype service objects per bundle.
+         */
+        std::size_t const prototypePoolCapacity;
 
         /**
          * Object instance with bundle scope that a factory may have produced.
@@ -97,6 +141,20 @@ namespace cppmicroservices
          * finished.
          */
         std::atomic<bool> unregistering;
+
+        /**
+         * True if the service was not registered with a ServiceFactory. The
+         * uses of such a service are counted in singletonUses instead of
+         * dependents.
+         */
+        bool const singleton;
+
+        /**
+         * Bundles using a singleton scope service. \c service may be read
+         * while holding one stripe of this counter; it is only reset while
+         * holding all of them.
+         */
+        ServiceUseCounter singletonUses;
     };
 } // namespace cppmicroservices
 
@@ -22,8 +22,12 @@
 
 #include "ServiceRegistry.h"
 
+#include "cppmicroservices/BundleEventHook.h"
+#include "cppmicroservices/BundleFindHook.h"
 #include "cppmicroservices/PrototypeServiceFactory.h"
+#include "cppmicroservices/ServiceEventListenerHook.h"
 #include "cppmicroservices/ServiceFactory.h"
+#include "cppmicroservices/ServiceFindHook.h"
 
 #include "BundlePrivate.h"
 #include "CoreBundleContext.h"
@@ -44,6 +48,11 @@ namespace cppmicroservices
         services.clear();
         classServices.clear();
         serviceRegistrations.clear();
+        for (auto& hc : hookCaches)
+        {
+            hc.second.hasHooks = false;
+            hc.second.registrations.Store(nullptr);
+        }
     }
 
     Properties
@@ -79,7 +88,61 @@ namespace cppmicroservices
         return Properties(AnyMap(std::move(props)));
     }
 
-    ServiceRegistry::ServiceRegistry(CoreBundleContext* coreCtx) : core(coreCtx) {}
+    namespace
+    {
+        detail::LockSite registryLockSite("ServiceRegistry");
+    } // namespace
+
+    ServiceRegistry::ServiceRegistry(CoreBundleContext* coreCtx) : core(coreCtx)
+    {
+        SetLockSite(&registryLockSite);
+        for (auto const& clazz : { us_service_interface_iid<BundleFindHook>(),
+                                   us_service_interface_iid<BundleEventHook>(),
+                                   us_service_interface_iid<ServiceFindHook>(),
+                                   us_service_interface_iid<ServiceEventListenerHook>() })
+        {
+            hookCaches[clazz];
+        }
+    }
+
+    ServiceRegistry::~ServiceRegistry() { SetLockSite(nullptr); }
+
+    void
+    ServiceRegistry::UpdateHookCache_unlocked(std::string const& clazz)
+    {
+        auto hc = hookCaches.find(clazz);
+        if (hc == hookCaches.end())
+        {
+            return;
+        }
+
+        auto i = classServices.find(clazz);
+        if (i == classServices.end() || i->second.empty())
+        {
+            hc->second.hasHooks = false;
+            hc->second.registrations.Store(nullptr);
+        }
+        else
+        {
+            hc->second.registrations.Store(std::make_shared<ServiceRegistrations const>(i->second));
+            hc->second.hasHooks = true;
+        }
+    }
+
+    std::shared_ptr<ServiceRegistry::ServiceRegistrations const>
+    ServiceRegistry::GetHooks(std::string const& clazz) const
+    {
+        auto hc = hookCaches.find(clazz);
+        if (hc == hookCaches.end())
+        {
+            throw std::invalid_argument(clazz + " is not a framework hook class");
+        }
+        if (!hc->second.hasHooks)
+        {
+            return nullptr;
+        }
+        return hc->second.registrations.Load();
+    }
 
     ServiceRegistrationBase
     ServiceRegistry::RegisterService(BundlePrivate* bundle,
@@ -119,9 +182,15 @@ namespace cppmicroservices
             serviceRegistrations.push_back(res);
             for (auto& clazz : classes)
             {
-                auto& s = classServices[clazz];
+                auto i = classServices.find(clazz);
+                if (i == classServices.end())
+                {
+                    i = classServices.emplace(clazz, MapClassServices::mapped_type()).first;
+                }
+                auto& s = i->second;
                 auto ip = std::lower_bound(s.rbegin(), s.rend(), res);
                 s.insert(ip.base(), res);
+                UpdateHookCache_unlocked(clazz);
             }
         }
 
@@ -140,8 +209,12 @@ namespace cppmicroservices
         US_UNUSED(l);
         for (auto& clazz : classes)
         {
-            auto& s = classServices[clazz];
-            std::sort(s.rbegin(), s.rend());
+            auto i = classServices.find(clazz);
+            if (i != classServices.end())
+            {
+                std::sort(i->second.rbegin(), i->second.rend());
+                UpdateHookCache_unlocked(clazz);
+            }
         }
     }
 
@@ -308,15 +381,20 @@ namespace cppmicroservices
                                    serviceRegistrations.end());
         for (auto& clazz : classes)
         {
-            auto& s = classServices[clazz];
-            if (s.size() > 1)
-            {
-                s.erase(std::remove(s.begin(), s.end(), sr), s.end());
-            }
-            else
+            auto i = classServices.find(clazz);
+            if (i != classServices.end())
             {
-                classServices.erase(clazz);
+                auto& s = i->second;
+                if (s.size() > 1)
+                {
+                    s.erase(std::remove(s.begin(), s.end(), sr), s.end());
+                }
+                else
+                {
+                    classServices.erase(i);
+                }
             }
+            UpdateHookCache_unlocked(clazz);
         }
     }
 
@@ -27,6 +27,9 @@
 #include "cppmicroservices/ServiceRegistration.h"
 #include "cppmicroservices/detail/Threads.h"
 
+#include <atomic>
+#include <memory>
+
 namespace cppmicroservices
 {
 
@@ -60,6 +63,7 @@ namespace cppmicroservices
 
         using MapServiceClasses = std::unordered_map<ServiceRegistrationBase, std::vector<std::string>>;
         using MapClassServices = std::unordered_map<std::string, std::vector<ServiceRegistrationBase>>;
+        using ServiceRegistrations = std::vector<ServiceRegistrationBase>;
 
         /**
          * All registered services in the current framework.
@@ -83,6 +87,7 @@ namespace cppmicroservices
         ServiceRegistry& operator=(ServiceRegistry const&) = delete;
 
         ServiceRegistry(CoreBundleContext* coreCtx);
+        ~ServiceRegistry();
 
         /**
          * Register a service in the framework wide register.
@@ -120,6 +125,19 @@ namespace cppmicroservices
          */
         void Get(std::string const& clazz, std::vector<ServiceRegistrationBase>& serviceRegs) const;
 
+        /**
+         * Get all registered hook services of a certain hook class, without
+         * taking the registry lock. The framework hook classes are cached;
+         * the cached list is replaced whenever a hook of that class is
+         * registered, unregistered or re-ranked.
+         * Safe to call with or without the registry lock held.
+         *
+         * @param clazz The class name of the hook service.
+         * @return The hook registrations ordered with the highest ranked
+         *         service first, or <code>nullptr</code> if there are none.
+         */
+        std::shared_ptr<ServiceRegistrations const> GetHooks(std::string const& clazz) const;
+
         /**
          * Get a service implementing a certain class.
          *
@@ -170,6 +188,21 @@ namespace cppmicroservices
         friend class ServiceHooks;
         friend class ServiceRegistrationBase;
 
+        struct HookCache
+        {
+            std::atomic<bool> hasHooks{ false };
+            detail::Atomic<std::shared_ptr<ServiceRegistrations const>> registrations;
+        };
+
+        /**
+         * Cached registrations of the framework hook classes, keyed by
+         * class name. The set of keys is fixed at construction time, so
+         * lookups need no locking.
+         */
+        std::unordered_map<std::string, HookCache> hookCaches;
+
+        void UpdateHookCache_unlocked(std::string const& clazz);
+
         void RemoveServiceRegistration_unlocked(ServiceRegistrationBase const& sr);
 
         void Get_unlocked(std::string const& clazz, std::vector<ServiceRegistrationBase>& serviceRegs) const;
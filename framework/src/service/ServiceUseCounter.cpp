@@ -0,0 +1,213 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+
+#include "ServiceUseCounter.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace cppmicroservices
+{
+
+    ServiceUseCounter::~ServiceUseCounter() { delete[] stripes.load(); }
+
+    std::size_t
+    ServiceUseCounter::StripeCount()
+    {
+        // A power of two of at least the number of hardware threads, capped
+        // to bound the memory used per service.
+        static std::size_t const count = []
+        {
+            std::size_t const threads = std::max(1u, std::thread::hardware_concurrency());
+            std::size_t n = 1;
+            while (n < threads && n < 32)
+            {
+                n <<= 1;
+            }
+            return n;
+        }();
+        return count;
+    }
+
+    std::size_t
+    ServiceUseCounter::CurrentStripe()
+    {
+        // Threads are assigned stripes round robin, which spreads them more
+        // evenly than hashing their ids.
+        static std::atomic<std::size_t> nextThread { 0 };
+        thread_local std::size_t const stripe = nextThread++ & (StripeCount() - 1);
+        return stripe;
+    }
+
+    ServiceUseCounter::Stripe*
+    ServiceUseCounter::GetStripes()
+    {
+        auto current = stripes.load(std::memory_order_acquire);
+        if (current == nullptr)
+        {
+            auto allocated = new Stripe[StripeCount()];
+            if (stripes.compare_exchange_strong(current, allocated, std::memory_order_acq_rel))
+            {
+                current = allocated;
+            }
+            else
+            {
+                delete[] allocated;
+            }
+        }
+        return current;
+    }
+
+    std::unique_lock<std::mutex>
+    ServiceUseCounter::LockStripe(std::size_t stripe)
+    {
+        return std::unique_lock<std::mutex>(GetStripes()[stripe].mutex);
+    }
+
+    std::vector<std::unique_lock<std::mutex>>
+    ServiceUseCounter::LockAll()
+    {
+        std::vector<std::unique_lock<std::mutex>> locks;
+        auto const all = GetStripes();
+        auto const count = StripeCount();
+        locks.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            locks.emplace_back(all[i].mutex);
+        }
+        return locks;
+    }
+
+    void
+    ServiceUseCounter::Acquire_unlocked(BundlePrivate* bundle, std::size_t stripe)
+    {
+        auto& uses = GetStripes()[stripe].uses;
+        auto iter = std::find_if(uses.begin(), uses.end(), [bundle](auto const& use) { return use.first == bundle; });
+        if (iter == uses.end())
+        {
+            uses.emplace_back(bundle, 1);
+        }
+        else
+        {
+            ++iter->second;
+        }
+    }
+
+    void
+    ServiceUseCounter::Release(BundlePrivate* bundle, std::size_t stripe)
+    {
+        auto const all = stripes.load(std::memory_order_acquire);
+        if (all == nullptr)
+        {
+            return;
+        }
+        auto& s = all[stripe];
+        std::lock_guard<std::mutex> lock(s.mutex);
+        auto iter
+            = std::find_if(s.uses.begin(), s.uses.end(), [bundle](auto const& use) { return use.first == bundle; });
+        if (iter != s.uses.end() && --iter->second == 0)
+        {
+            *iter = s.uses.back();
+            s.uses.pop_back();
+        }
+    }
+
+    bool
+    ServiceUseCounter::Remove(BundlePrivate* bundle)
+    {
+        bool removed = false;
+        auto const all = stripes.load(std::memory_order_acquire);
+        if (all == nullptr)
+        {
+            return removed;
+        }
+        for (std::size_t i = 0; i < StripeCount(); ++i)
+        {
+            std::lock_guard<std::mutex> lock(all[i].mutex);
+            auto& uses = all[i].uses;
+            auto const oldSize = uses.size();
+            uses.erase(std::remove_if(uses.begin(), uses.end(), [bundle](auto const& use) { return use.first == bundle; }),
+                       uses.end());
+            removed = removed || uses.size() != oldSize;
+        }
+        return removed;
+    }
+
+    bool
+    ServiceUseCounter::IsUsedBy(BundlePrivate* bundle)
+    {
+        auto const all = stripes.load(std::memory_order_acquire);
+        if (all == nullptr)
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < StripeCount(); ++i)
+        {
+            std::lock_guard<std::mutex> lock(all[i].mutex);
+            auto const& uses = all[i].uses;
+            if (std::any_of(uses.begin(), uses.end(), [bundle](auto const& use) { return use.first == bundle; }))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<BundlePrivate*>
+    ServiceUseCounter::GetUsers()
+    {
+        std::vector<BundlePrivate*> users;
+        auto const all = stripes.load(std::memory_order_acquire);
+        if (all == nullptr)
+        {
+            return users;
+        }
+        for (std::size_t i = 0; i < StripeCount(); ++i)
+        {
+            std::lock_guard<std::mutex> lock(all[i].mutex);
+            for (auto const& use : all[i].uses)
+            {
+                if (std::find(users.begin(), users.end(), use.first) == users.end())
+                {
+                    users.push_back(use.first);
+                }
+            }
+        }
+        return users;
+    }
+
+    void
+    ServiceUseCounter::Clear_unlocked()
+    {
+        auto const all = stripes.load(std::memory_order_acquire);
+        if (all == nullptr)
+        {
+            return;
+        }
+        for (std::size_t i = 0; i < StripeCount(); ++i)
+        {
+            all[i].uses.clear();
+        }
+    }
+
+} // namespace cppmicroservices
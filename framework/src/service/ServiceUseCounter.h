@@ -0,0 +1,118 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#ifndef CPPMICROSERVICES_SERVICEUSECOUNTER_H
+#define CPPMICROSERVICES_SERVICEUSECOUNTER_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cppmicroservices
+{
+
+    class BundlePrivate;
+
+    /**
+     * Counts the unbalanced GetService() calls of bundles on a singleton
+     * scope service.
+     *
+     * The counts are split into stripes and every thread updates the stripe
+     * returned by CurrentStripe(), so getting and releasing a service from
+     * many threads at once does not contend on a single lock. A use must be
+     * released in the stripe it was acquired in. Exact totals are only
+     * computed, by visiting all stripes, for queries and for unregistration.
+     *
+     * Stripes are allocated when the service is used for the first time.
+     */
+    class ServiceUseCounter
+    {
+      public:
+        ServiceUseCounter() = default;
+        ~ServiceUseCounter();
+
+        ServiceUseCounter(ServiceUseCounter const&) = delete;
+        ServiceUseCounter& operator=(ServiceUseCounter const&) = delete;
+
+        /**
+         * Returns the stripe the calling thread acquires uses in.
+         */
+        static std::size_t CurrentStripe();
+
+        /**
+         * Locks one stripe. Acquire_unlocked() may be called while the lock
+         * is held.
+         */
+        std::unique_lock<std::mutex> LockStripe(std::size_t stripe);
+
+        /**
+         * Locks all stripes, in index order.
+         */
+        std::vector<std::unique_lock<std::mutex>> LockAll();
+
+        void Acquire_unlocked(BundlePrivate* bundle, std::size_t stripe);
+
+        /**
+         * Releases one use acquired in \c stripe. Does nothing if \c bundle
+         * has no uses in that stripe, e.g. because they were removed by
+         * Remove() or Clear_unlocked().
+         */
+        void Release(BundlePrivate* bundle, std::size_t stripe);
+
+        /**
+         * Removes all uses of \c bundle.
+         *
+         * \return \c true if \c bundle used the service
+         */
+        bool Remove(BundlePrivate* bundle);
+
+        bool IsUsedBy(BundlePrivate* bundle);
+
+        /**
+         * Returns the bundles using the service, in no particular order.
+         */
+        std::vector<BundlePrivate*> GetUsers();
+
+        /**
+         * Removes all uses. All stripes must be locked by the caller.
+         */
+        void Clear_unlocked();
+
+      private:
+        struct alignas(64) Stripe
+        {
+            std::mutex mutex;
+            std::vector<std::pair<BundlePrivate*, long>> uses;
+        };
+
+        static std::size_t StripeCount();
+
+        Stripe* GetStripes();
+
+        std::atomic<Stripe*> stripes { nullptr };
+    };
+} // namespace cppmicroservices
+
+#endif // CPPMICROSERVICES_SERVICEUSECOUNTER_H
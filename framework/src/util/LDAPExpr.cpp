@@ -501,6 +501,38 @@ namespace cppmicroservices
         return false;
     }
 
+    bool
+    LDAPExpr::ReferencesAttribute(StringList const& attrNames, bool matchCase) const
+    {
+        if (!d)
+        {
+            return false;
+        }
+
+        if ((d->m_operator & SIMPLE) != 0)
+        {
+            for (auto const& attrName : attrNames)
+            {
+                if (attrName.length() == d->m_attrName.length()
+                    && (matchCase ? attrName == d->m_attrName
+                                  : std::equal(attrName.begin(), attrName.end(), d->m_attrName.begin(), stricomp)))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        for (auto const& arg : d->m_args)
+        {
+            if (arg.ReferencesAttribute(attrNames, matchCase))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     bool
     LDAPExpr::IsNull() const
     {
@@ -109,6 +109,18 @@ namespace cppmicroservices
          */
         bool IsSimple(StringList const& keywords, LocalCache& cache, bool matchCase) const;
 
+        /**
+         * Checks if this LDAP expression compares any of the given attributes.
+         * The result of evaluating the expression can only change if one
+         * of the attributes it compares changes.
+         *
+         * @param attrNames The attribute names to look for.
+         * @param matchCase Whether attribute names are compared case sensitively.
+         * @return <code>true</code> if one of <code>attrNames</code> is used
+         *         by this expression, <code>false</code> otherwise.
+         */
+        bool ReferencesAttribute(StringList const& attrNames, bool matchCase) const;
+
         /**
          * Returns <code>true</code> if this instance is invalid, i.e. it was
          * constructed using LDAPExpr().
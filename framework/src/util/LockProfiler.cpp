@@ -0,0 +1,395 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#include "cppmicroservices/LockProfiler.h"
+#include "cppmicroservices/detail/LockSite.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace cppmicroservices
+{
+
+    namespace
+    {
+        /**
+         * The site of a mutex and the start of the current profiled hold.
+         * Apart from the site, only touched by the holder of the mutex.
+         */
+        struct AssignedMutex
+        {
+            detail::LockSite* site = nullptr;
+            detail::LockSite::Clock::time_point acquired;
+            // The enable count generation of the acquisition, holds
+            // started before profiling was last enabled are not recorded
+            std::uint64_t generation = 0;
+        };
+
+        // Assignments are spread over several maps, so that profiled locks
+        // of unrelated mutexes rarely meet on the same table lock.
+        struct AssignmentShard
+        {
+            std::mutex mutex;
+            std::unordered_map<void const*, AssignedMutex> mutexes;
+        };
+
+        struct ProfilerState
+        {
+            std::mutex mutex;
+            int enableCount = 0;
+            std::atomic<std::uint64_t> generation { 0 };
+            std::vector<detail::LockSite*> sites;
+            std::array<AssignmentShard, 16> shards;
+
+            AssignmentShard&
+            ShardOf(void const* mutex)
+            {
+                return shards[std::hash<void const*>()(mutex) % shards.size()];
+            }
+        };
+
+        ProfilerState&
+        State()
+        {
+            // Never destroyed, framework objects kept alive by other
+            // libraries may still be locked after the static objects of
+            // this library are gone.
+            static auto* state = new ProfilerState;
+            return *state;
+        }
+
+        std::uint64_t
+        ToNanoseconds(detail::LockSite::Clock::duration d)
+        {
+            auto const ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+            return ns > 0 ? static_cast<std::uint64_t>(ns) : 0;
+        }
+
+        std::size_t
+        HistogramBucket(std::uint64_t ns)
+        {
+            std::size_t bucket = 0;
+            while (ns > 0 && bucket < detail::LockSite::HistogramSize - 1)
+            {
+                ns >>= 1;
+                ++bucket;
+            }
+            return bucket;
+        }
+
+        void
+        UpdateMax(std::atomic<std::uint64_t>& max, std::uint64_t value)
+        {
+            auto current = max.load(std::memory_order_relaxed);
+            while (current < value && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        void
+        Accumulate(std::vector<std::uint64_t>& to, detail::LockSite::Histogram const& from)
+        {
+            to.resize(from.size());
+            for (std::size_t i = 0; i < from.size(); ++i)
+            {
+                to[i] += from[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        double
+        ToMicroseconds(std::chrono::nanoseconds ns)
+        {
+            return std::chrono::duration<double, std::micro>(ns).count();
+        }
+    } // namespace
+
+    namespace detail
+    {
+        std::atomic<bool> LockSite::profiling { false };
+
+        LockSite::LockSite(char const* name) : name(name)
+        {
+            Reset();
+            auto& state = State();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.sites.push_back(this);
+        }
+
+        LockSite::~LockSite()
+        {
+            auto& state = State();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.sites.erase(std::remove(state.sites.begin(), state.sites.end(), this), state.sites.end());
+        }
+
+        void
+        LockSite::Assign(void const* mutex, LockSite* site)
+        {
+            auto& shard = State().ShardOf(mutex);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (site == nullptr)
+            {
+                shard.mutexes.erase(mutex);
+            }
+            else
+            {
+                shard.mutexes[mutex].site = site;
+            }
+        }
+
+        void
+        LockSite::Acquired(void const* mutex, Clock::duration wait, bool contended) noexcept
+        {
+            auto& state = State();
+            auto& shard = state.ShardOf(mutex);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto iter = shard.mutexes.find(mutex);
+            if (iter != shard.mutexes.end())
+            {
+                iter->second.acquired = Clock::now();
+                iter->second.generation = state.generation.load(std::memory_order_relaxed);
+                iter->second.site->RecordAcquisition(wait, contended);
+            }
+        }
+
+        void
+        LockSite::Released(void const* mutex) noexcept
+        {
+            auto& state = State();
+            auto& shard = state.ShardOf(mutex);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto iter = shard.mutexes.find(mutex);
+            if (iter != shard.mutexes.end()
+                && iter->second.generation == state.generation.load(std::memory_order_relaxed))
+            {
+                // a hold is recorded at most once
+                iter->second.generation = 0;
+                iter->second.site->RecordHold(Clock::now() - iter->second.acquired);
+            }
+        }
+
+        void
+        LockSite::Reacquired(void const* mutex) noexcept
+        {
+            auto& state = State();
+            auto& shard = state.ShardOf(mutex);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto iter = shard.mutexes.find(mutex);
+            if (iter != shard.mutexes.end())
+            {
+                iter->second.acquired = Clock::now();
+                iter->second.generation = state.generation.load(std::memory_order_relaxed);
+            }
+        }
+
+        void
+        LockSite::RecordAcquisition(Clock::duration wait, bool contended) noexcept
+        {
+            auto const ns = ToNanoseconds(wait);
+            acquisitions.fetch_add(1, std::memory_order_relaxed);
+            if (contended)
+            {
+                contentions.fetch_add(1, std::memory_order_relaxed);
+            }
+            totalWaitNs.fetch_add(ns, std::memory_order_relaxed);
+            UpdateMax(maxWaitNs, ns);
+            waitHistogram[HistogramBucket(ns)].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void
+        LockSite::RecordHold(Clock::duration hold) noexcept
+        {
+            auto const ns = ToNanoseconds(hold);
+            totalHoldNs.fetch_add(ns, std::memory_order_relaxed);
+            UpdateMax(maxHoldNs, ns);
+            holdHistogram[HistogramBucket(ns)].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void
+        LockSite::Reset() noexcept
+        {
+            acquisitions = 0;
+            contentions = 0;
+            totalWaitNs = 0;
+            maxWaitNs = 0;
+            totalHoldNs = 0;
+            maxHoldNs = 0;
+            for (auto& bucket : waitHistogram)
+            {
+                bucket = 0;
+            }
+            for (auto& bucket : holdHistogram)
+            {
+                bucket = 0;
+            }
+        }
+    } // namespace detail
+
+    bool
+    LockProfiler::IsEnabled() noexcept
+    {
+        return detail::LockSite::IsProfiling();
+    }
+
+    void
+    LockProfiler::Enable()
+    {
+        auto& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.enableCount++ == 0)
+        {
+            // generation 0 marks holds which are not profiled
+            state.generation.fetch_add(1, std::memory_order_relaxed);
+            detail::LockSite::profiling = true;
+        }
+    }
+
+    void
+    LockProfiler::Disable()
+    {
+        auto& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.enableCount > 0 && --state.enableCount == 0)
+        {
+            detail::LockSite::profiling = false;
+        }
+    }
+
+    std::vector<LockSiteStatistics>
+    LockProfiler::GetStatistics()
+    {
+        std::map<std::string, LockSiteStatistics> byName;
+        {
+            auto& state = State();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            for (auto const* site : state.sites)
+            {
+                auto const acquisitions = site->acquisitions.load(std::memory_order_relaxed);
+                if (acquisitions == 0)
+                {
+                    continue;
+                }
+
+                auto& stats = byName[site->GetName()];
+                stats.name = site->GetName();
+                stats.acquisitions += acquisitions;
+                stats.contentions += site->contentions.load(std::memory_order_relaxed);
+                stats.totalWait += std::chrono::nanoseconds(site->totalWaitNs.load(std::memory_order_relaxed));
+                stats.maxWait = (std::max)(stats.maxWait,
+                                           std::chrono::nanoseconds(site->maxWaitNs.load(std::memory_order_relaxed)));
+                stats.totalHold += std::chrono::nanoseconds(site->totalHoldNs.load(std::memory_order_relaxed));
+                stats.maxHold = (std::max)(stats.maxHold,
+                                           std::chrono::nanoseconds(site->maxHoldNs.load(std::memory_order_relaxed)));
+                Accumulate(stats.waitHistogram, site->waitHistogram);
+                Accumulate(stats.holdHistogram, site->holdHistogram);
+            }
+        }
+
+        std::vector<LockSiteStatistics> result;
+        result.reserve(byName.size());
+        for (auto& entry : byName)
+        {
+            result.push_back(std::move(entry.second));
+        }
+        std::stable_sort(result.begin(),
+                         result.end(),
+                         [](LockSiteStatistics const& a, LockSiteStatistics const& b)
+                         { return a.totalWait > b.totalWait; });
+        return result;
+    }
+
+    void
+    LockProfiler::Reset()
+    {
+        auto& state = State();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        for (auto* site : state.sites)
+        {
+            site->Reset();
+        }
+    }
+
+    std::chrono::nanoseconds
+    LockProfiler::Percentile(std::vector<std::uint64_t> const& histogram, double percentile)
+    {
+        std::uint64_t total = 0;
+        for (auto count : histogram)
+        {
+            total += count;
+        }
+        if (total == 0)
+        {
+            return std::chrono::nanoseconds(0);
+        }
+
+        auto const clamped = (std::min)((std::max)(percentile, 0.0), 1.0);
+        auto const rank = (std::max)(static_cast<std::uint64_t>(std::ceil(clamped * static_cast<double>(total))),
+                                     std::uint64_t(1));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < histogram.size(); ++i)
+        {
+            seen += histogram[i];
+            if (seen >= rank)
+            {
+                return std::chrono::nanoseconds(std::int64_t(1) << i);
+            }
+        }
+        return std::chrono::nanoseconds(std::int64_t(1) << (histogram.size() - 1));
+    }
+
+    void
+    LockProfiler::WriteReport(std::ostream& out)
+    {
+        auto const stats = GetStatistics();
+
+        auto const flags = out.flags();
+        auto const precision = out.precision();
+        out << "Lock profiling is " << (IsEnabled() ? "enabled" : "disabled")
+            << ", times in microseconds, percentiles are histogram bucket upper bounds\n";
+        out << std::left << std::setw(40) << "Site" << std::right << std::setw(12) << "Acquired"
+            << std::setw(12) << "Contended" << std::setw(12) << "Wait" << std::setw(10) << "p50" << std::setw(10)
+            << "p99" << std::setw(10) << "max" << std::setw(12) << "Hold" << std::setw(10) << "p50"
+            << std::setw(10) << "p99" << std::setw(10) << "max"
+            << "\n";
+        out << std::fixed << std::setprecision(1);
+        for (auto const& site : stats)
+        {
+            out << std::left << std::setw(40) << site.name << std::right << std::setw(12) << site.acquisitions
+                << std::setw(12) << site.contentions << std::setw(12) << ToMicroseconds(site.totalWait)
+                << std::setw(10) << ToMicroseconds(Percentile(site.waitHistogram, 0.5)) << std::setw(10)
+                << ToMicroseconds(Percentile(site.waitHistogram, 0.99)) << std::setw(10)
+                << ToMicroseconds(site.maxWait) << std::setw(12) << ToMicroseconds(site.totalHold) << std::setw(10)
+                << ToMicroseconds(Percentile(site.holdHistogram, 0.5)) << std::setw(10)
+                << ToMicroseconds(Percentile(site.holdHistogram, 0.99)) << std::setw(10)
+                << ToMicroseconds(site.maxHold) << "\n";
+        }
+        out.flags(flags);
+        out.precision(precision);
+    }
+} // namespace cppmicroservices
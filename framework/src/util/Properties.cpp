@@ -282,6 +282,74 @@ namespace cppmicroservices
     Properties::Clear_unlocked()
     {
         props.clear();
+        caseInsensitiveLookup.clear();
+    }
+
+    std::string const*
+    Properties::FindKey_unlocked(std::string const& key) const
+    {
+        if (props.GetType() == AnyMap::UNORDERED_MAP_CASEINSENSITIVE_KEYS)
+        {
+            auto itr = props.findUOCI_TypeChecked(key);
+            return itr != props.endUOCI_TypeChecked() ? &itr->first : nullptr;
+        }
+        else if (props.GetType() == AnyMap::UNORDERED_MAP)
+        {
+            auto itr = props.findUO_TypeChecked(key);
+            if (itr != props.endUO_TypeChecked())
+            {
+                return &itr->first;
+            }
+        }
+        else if (props.GetType() == AnyMap::ORDERED_MAP)
+        {
+            auto itr = props.findOM_TypeChecked(key);
+            if (itr != props.endOM_TypeChecked())
+            {
+                return &itr->first;
+            }
+        }
+        else
+        {
+            throw std::runtime_error("Unknown AnyMap type.");
+        }
+
+        PopulateCaseInsensitiveLookupMap();
+        auto ciItr = caseInsensitiveLookup.find(key);
+        return ciItr != caseInsensitiveLookup.end() ? &*ciItr : nullptr;
+    }
+
+    void
+    Properties::Set_unlocked(std::string const& key, Any value)
+    {
+        if (auto existing = FindKey_unlocked(key); existing && *existing != key)
+        {
+            Remove_unlocked(std::string(*existing));
+        }
+
+        props[key] = std::move(value);
+        // Keep an already populated lookup map complete; an empty one is
+        // populated on demand.
+        if (props.GetType() != AnyMap::UNORDERED_MAP_CASEINSENSITIVE_KEYS && !caseInsensitiveLookup.empty())
+        {
+            caseInsensitiveLookup.insert(key);
+        }
+    }
+
+    bool
+    Properties::Remove_unlocked(std::string const& key)
+    {
+        auto existing = FindKey_unlocked(key);
+        if (!existing)
+        {
+            return false;
+        }
+
+        // Copy the key, erasing it from the lookup map may invalidate existing.
+        std::string const storedKey(*existing);
+        caseInsensitiveLookup.erase(storedKey);
+        props.erase(storedKey);
+        return true;
     }
 } // namespace cppmicroservices
 
@@ -52,6 +52,19 @@ namespace cppmicroservices
 
         void Clear_unlocked();
 
+        /**
+         * Sets the value of a property. A property whose key only differs in
+         * case from \c key is replaced, including its key.
+         */
+        void Set_unlocked(std::string const& key, Any value);
+
+        /**
+         * Removes the property whose key matches \c key, ignoring case.
+         *
+         * \return \c true if a property was removed.
+         */
+        bool Remove_unlocked(std::string const& key);
+
         AnyMap const&
         GetPropsAnyMap() const
         {
@@ -74,6 +87,9 @@ namespace cppmicroservices
         // Helper that populates the case-insensitive lookup map when the provided AnyMap is not
         // already case insensitive.
         void PopulateCaseInsensitiveLookupMap() const;
+
+        // Returns the stored key matching the given key, ignoring case, or nullptr.
+        std::string const* FindKey_unlocked(std::string const& key) const;
     };
 
     class PropertiesHandle
@@ -0,0 +1,244 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+
+#include "cppmicroservices/detail/Trace.h"
+
+#include <atomic>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace cppmicroservices
+{
+
+    namespace detail
+    {
+
+        namespace
+        {
+            struct TraceEvent
+            {
+                char const* category;
+                char const* name;
+                std::string detail;
+                Tracer::Clock::time_point begin;
+                Tracer::Clock::time_point end;
+            };
+
+            struct ThreadBuffer
+            {
+                std::mutex mutex;
+                std::vector<TraceEvent> events;
+                std::size_t dropped = 0;
+                unsigned int tid = 0;
+            };
+
+            struct TraceState
+            {
+                std::atomic<int> enableCount { 0 };
+                std::mutex mutex;
+                std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+                Tracer::Clock::time_point epoch;
+                unsigned int nextTid = 0;
+            };
+
+            TraceState&
+            State()
+            {
+                static TraceState state;
+                return state;
+            }
+
+            ThreadBuffer&
+            LocalBuffer()
+            {
+                // The state keeps a reference too, so spans recorded by threads
+                // which already exited are still written.
+                thread_local std::shared_ptr<ThreadBuffer> buffer;
+                if (!buffer)
+                {
+                    auto newBuffer = std::make_shared<ThreadBuffer>();
+                    auto& state = State();
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    newBuffer->tid = ++state.nextTid;
+                    state.buffers.push_back(newBuffer);
+                    buffer = std::move(newBuffer);
+                }
+                return *buffer;
+            }
+
+            void
+            WriteJsonString(std::ostream& out, std::string const& str)
+            {
+                out << '"';
+                for (char const c : str)
+                {
+                    switch (c)
+                    {
+                        case '"':
+                            out << "\\\"";
+                            break;
+                        case '\\':
+                            out << "\\\\";
+                            break;
+                        case '\n':
+                            out << "\\n";
+                            break;
+                        case '\r':
+                            out << "\\r";
+                            break;
+                        case '\t':
+                            out << "\\t";
+                            break;
+                        default:
+                            if (static_cast<unsigned char>(c) < 0x20)
+                            {
+                                out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                                    << static_cast<int>(c) << std::dec << std::setfill(' ');
+                            }
+                            else
+                            {
+                                out << c;
+                            }
+                    }
+                }
+                out << '"';
+            }
+        } // namespace
+
+        bool
+        Tracer::IsEnabled() noexcept
+        {
+            return State().enableCount.load(std::memory_order_relaxed) > 0;
+        }
+
+        void
+        Tracer::Enable()
+        {
+            auto& state = State();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (state.enableCount.load() == 0)
+            {
+                state.epoch = Clock::now();
+            }
+            ++state.enableCount;
+        }
+
+        void
+        Tracer::Disable()
+        {
+            auto& state = State();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (state.enableCount.load() == 0 || --state.enableCount > 0)
+            {
+                return;
+            }
+
+            // Keep the buffers of live threads, they are referenced thread locally.
+            std::vector<std::shared_ptr<ThreadBuffer>> liveBuffers;
+            for (auto& buffer : state.buffers)
+            {
+                std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+                buffer->events.clear();
+                buffer->dropped = 0;
+                if (buffer.use_count() > 1)
+                {
+                    liveBuffers.push_back(std::move(buffer));
+                }
+            }
+            state.buffers.swap(liveBuffers);
+        }
+
+        void
+        Tracer::Record(char const* category,
+                       char const* name,
+                       std::string const& detail,
+                       Clock::time_point begin,
+                       Clock::time_point end) noexcept
+        {
+            if (!IsEnabled())
+            {
+                return;
+            }
+            try
+            {
+                auto& buffer = LocalBuffer();
+                std::lock_guard<std::mutex> lock(buffer.mutex);
+                if (buffer.events.size() >= MAX_SPANS_PER_THREAD)
+                {
+                    ++buffer.dropped;
+                    return;
+                }
+                buffer.events.push_back({ category, name, detail, begin, end });
+            }
+            catch (...)
+            {
+                // a span which cannot be recorded is dropped
+            }
+        }
+
+        void
+        Tracer::WriteChromeTrace(std::ostream& out)
+        {
+            using Micros = std::chrono::duration<double, std::micro>;
+
+            auto& state = State();
+            std::lock_guard<std::mutex> lock(state.mutex);
+
+            out << "{\"traceEvents\":[";
+            bool first = true;
+            auto const flags = out.flags();
+            auto const precision = out.precision();
+            out << std::fixed << std::setprecision(3);
+            std::size_t dropped = 0;
+            for (auto const& buffer : state.buffers)
+            {
+                std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+                dropped += buffer->dropped;
+                for (auto const& event : buffer->events)
+                {
+                    out << (first ? "\n" : ",\n");
+                    first = false;
+                    out << "{\"name\":";
+                    WriteJsonString(out, event.name);
+                    out << ",\"cat\":";
+                    WriteJsonString(out, event.category);
+                    out << ",\"ph\":\"X\",\"ts\":" << Micros(event.begin - state.epoch).count()
+                        << ",\"dur\":" << Micros(event.end - event.begin).count() << ",\"pid\":1,\"tid\":" << buffer->tid;
+                    if (!event.detail.empty())
+                    {
+                        out << ",\"args\":{\"detail\":";
+                        WriteJsonString(out, event.detail);
+                        out << '}';
+                    }
+                    out << '}';
+                }
+            }
+            out.flags(flags);
+            out.precision(precision);
+            out << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedSpans\":" << dropped << "}}\n";
+        }
+
+    } // namespace detail
+} // namespace cppmicroservices
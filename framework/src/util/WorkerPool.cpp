@@ -0,0 +1,90 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#include "WorkerPool.h"
+
+#include <algorithm>
+
+namespace cppmicroservices
+{
+
+    WorkerPool::WorkerPool(std::size_t maxThreads)
+        : maxThreads(maxThreads > 0 ? maxThreads
+                                    : (std::max)(std::thread::hardware_concurrency(), 1u))
+        , idleThreads(0)
+        , stopping(false)
+    {
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        taskAvailable.notify_all();
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    std::future<void>
+    WorkerPool::Submit(std::function<void()> task)
+    {
+        std::packaged_task<void()> packagedTask(std::move(task));
+        auto result = packagedTask.get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(std::move(packagedTask));
+            if (tasks.size() > idleThreads && threads.size() < maxThreads)
+            {
+                threads.emplace_back(&WorkerPool::Run, this);
+            }
+        }
+        taskAvailable.notify_one();
+        return result;
+    }
+
+    void
+    WorkerPool::Run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            ++idleThreads;
+            taskAvailable.wait(lock, [this] { return stopping || !tasks.empty(); });
+            --idleThreads;
+            if (tasks.empty())
+            {
+                // stopping, and all queued tasks have run
+                return;
+            }
+
+            auto task = std::move(tasks.front());
+            tasks.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+} // namespace cppmicroservices
@@ -0,0 +1,78 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#ifndef CPPMICROSERVICES_WORKERPOOL_H
+#define CPPMICROSERVICES_WORKERPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cppmicroservices
+{
+
+    /**
+     * Runs tasks in FIFO order on at most a fixed number of threads.
+     *
+     * Threads are started on demand when tasks are submitted, so a pool
+     * which is never used costs no threads. Destroying the pool runs the
+     * tasks which are still queued and joins all threads.
+     */
+    class WorkerPool final
+    {
+      public:
+        /**
+         * @param maxThreads The maximum number of threads. Zero means
+         *        std::thread::hardware_concurrency(), or one if that is unknown.
+         */
+        explicit WorkerPool(std::size_t maxThreads = 0);
+        ~WorkerPool();
+
+        WorkerPool(WorkerPool const&) = delete;
+        WorkerPool& operator=(WorkerPool const&) = delete;
+
+        /**
+         * Queues a task. The returned future becomes ready when the task
+         * has run, and holds the exception the task threw, if any.
+         */
+        std::future<void> Submit(std::function<void()> task);
+
+      private:
+        void Run();
+
+        std::size_t const maxThreads;
+
+        std::mutex mutex;
+        std::condition_variable taskAvailable;
+        std::deque<std::packaged_task<void()>> tasks;
+        std::vector<std::thread> threads;
+        std::size_t idleThreads;
+        bool stopping;
+    };
+} // namespace cppmicroservices
+
+#endif // CPPMICROSERVICES_WORKERPOOL_H
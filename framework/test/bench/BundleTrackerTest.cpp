@@ -6,6 +6,7 @@
 #include <cppmicroservices/FrameworkFactory.h>
 
 #include <chrono>
+#include <vector>
 
 #include "TestUtils.h"
 #include "benchmark/benchmark.h"
@@ -230,6 +231,73 @@ BENCHMARK_DEFINE_F(BundleTrackerFixture, BundleTrackerScalability)
   }
 }
 
+BENCHMARK_DEFINE_F(BundleTrackerFixture, BundleTrackerLifecycleBurst)
+(benchmark::State& state)
+{
+  auto context = framework->GetBundleContext();
+  auto stateMask =
+    BundleTracker<>::CreateStateMask(Bundle::State::STATE_ACTIVE);
+  BundleTracker<> bundleTracker(context, stateMask);
+  bundleTracker.Open();
+
+  std::vector<Bundle> bundles;
+  for (auto name : { "TestBundleA", "TestBundleB", "TestBundleH",
+                     "TestBundleM", "TestBundleR" }) {
+    bundles.emplace_back(testing::InstallLib(context, name));
+  }
+
+  // Measure a burst of lifecycle changes, coalesced into one
+  // customizer call per burst if state.range(0) is non-zero
+  const bool batched = state.range(0) != 0;
+  for (auto _ : state) {
+    auto start = std::chrono::high_resolution_clock::now();
+    if (batched) {
+      bundleTracker.BeginBatch();
+    }
+    for (auto& bundle : bundles) {
+      bundle.Start();
+    }
+    if (batched) {
+      bundleTracker.EndBatch();
+      bundleTracker.BeginBatch();
+    }
+    for (auto& bundle : bundles) {
+      bundle.Stop();
+    }
+    if (batched) {
+      bundleTracker.EndBatch();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto elapsed_time =
+      std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+    state.SetIterationTime(elapsed_time.count());
+  }
+
+  bundleTracker.Close();
+}
+
+BENCHMARK_DEFINE_F(BundleTrackerFixture, BundleTrackerGetTracked)
+(benchmark::State& state)
+{
+  auto context = framework->GetBundleContext();
+  BundleTracker<> bundleTracker(context, all_states);
+  bundleTracker.Open();
+  testing::InstallLib(context, "TestBundleA");
+
+  // Compare copying the tracked map with reading the shared snapshot
+  const bool snapshot = state.range(0) != 0;
+  for (auto _ : state) {
+    if (snapshot) {
+      benchmark::DoNotOptimize(bundleTracker.GetTrackedSnapshot());
+    } else {
+      benchmark::DoNotOptimize(bundleTracker.GetTracked());
+    }
+  }
+
+  bundleTracker.Close();
+}
+
 #ifdef PERFORM_LARGE_BUNDLETRACKER_TEST
 BENCHMARK_DEFINE_F(BundleTrackerFixture, BundleTrackerBundleScalability)
 (benchmark::State& state)
@@ -290,6 +358,13 @@ BENCHMARK_REGISTER_F(BundleTrackerFixture, BundleTrackerScalability)
   ->RangeMultiplier(4)
   ->Range(0, 1000)
   ->UseManualTime();
+BENCHMARK_REGISTER_F(BundleTrackerFixture, BundleTrackerLifecycleBurst)
+  ->Arg(0)
+  ->Arg(1)
+  ->UseManualTime();
+BENCHMARK_REGISTER_F(BundleTrackerFixture, BundleTrackerGetTracked)
+  ->Arg(0)
+  ->Arg(1);
 
 #ifdef PERFORM_LARGE_BUNDLETRACKER_TEST
 BENCHMARK_REGISTER_F(BundleTrackerFixture, BundleTrackerBundleScalability)
@@ -0,0 +1,311 @@
+#include "benchmark/benchmark.h"
+
+#include <cppmicroservices/Bundle.h>
+#include <cppmicroservices/BundleContext.h>
+#include <cppmicroservices/Constants.h>
+#include <cppmicroservices/Framework.h>
+#include <cppmicroservices/FrameworkEvent.h>
+#include <cppmicroservices/FrameworkFactory.h>
+#include <cppmicroservices/ServiceEvent.h>
+#include <cppmicroservices/ServiceTracker.h>
+
+#include "cppmicroservices/util/FileSystem.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/*
+ * Scaling benchmarks: mixed workloads run from 1 to 64 threads against
+ * frameworks populated with 10^2 to 10^5 services, service listeners or
+ * bundles. Each run reports its population size as a counter, so the results
+ * can be tracked over time, e.g. with the JSON written by the
+ * usFrameworkBenchScalingReport target. They are built into their own
+ * executable, usFrameworkBenchScalingTests, and are not part of the default
+ * benchmark run.
+ */
+
+using namespace cppmicroservices;
+
+namespace
+{
+    /*
+     * Interface of the services populating the framework.
+     */
+    class ScaleService
+    {
+    };
+
+    /*
+     * Interface of the services registered and unregistered by the event
+     * storm benchmark.
+     */
+    class StormService
+    {
+    };
+
+    /*
+     * Manifests of <code>count</code> bundles without activator, which are
+     * installed from the benchmark executable. This generates bundle
+     * populations of any size without building a shared library per bundle.
+     */
+    AnyMap
+    GenerateBundleManifests(int64_t count)
+    {
+        AnyMap manifests(any_map::UNORDERED_MAP_CASEINSENSITIVE_KEYS);
+        for (int64_t i = 0; i < count; ++i)
+        {
+            auto const name = "ScaleBundle" + std::to_string(i);
+            AnyMap::unordered_any_cimap manifest = {
+                {Constants::BUNDLE_SYMBOLICNAME,                    name},
+                {     Constants::BUNDLE_VERSION, std::string("1.0.0")},
+                {   Constants::BUNDLE_ACTIVATOR,                   false}
+            };
+            manifests[name] = AnyMap(manifest);
+        }
+        return manifests;
+    }
+
+    /*
+     * Location of the generated bundles. The location must exist, but it is
+     * never opened, because the manifests are given and the bundles have no
+     * activator. The executable itself cannot be used: its embedded bundle is
+     * installed when the framework starts, and the manifests given for an
+     * already used location are ignored.
+     */
+    std::string
+    GeneratedBundlesLocation()
+    {
+        auto const executable = util::GetExecutablePath();
+        return executable.substr(0, executable.find_last_of(util::DIR_SEP));
+    }
+
+    /*
+     * A started framework with a population of services, service listeners
+     * and bundles, shared by all threads of a benchmark run.
+     */
+    struct Population
+    {
+        Population(int64_t services, int64_t listeners, int64_t bundleCount)
+            : framework(FrameworkFactory().NewFramework())
+            , deliveries(0)
+            , next(0)
+        {
+            framework.Start();
+            auto fc = framework.GetBundleContext();
+
+            auto const impl = std::make_shared<ScaleService>();
+            registrations.reserve(static_cast<std::size_t>(services));
+            for (int64_t i = 0; i < services; ++i)
+            {
+                registrations.push_back(fc.RegisterService<ScaleService>(impl,
+                                                                         {
+                                                                             {"scale.index", Any(static_cast<int>(i))}
+                }));
+            }
+
+            auto const filter = "(" + Constants::OBJECTCLASS + "=" + us_service_interface_iid<StormService>() + ")";
+            for (int64_t i = 0; i < listeners; ++i)
+            {
+                fc.AddServiceListener([this](ServiceEvent const&)
+                                      { deliveries.fetch_add(1, std::memory_order_relaxed); },
+                                      filter);
+            }
+
+            if (bundleCount > 0)
+            {
+                bundles = fc.InstallBundles(GeneratedBundlesLocation(), GenerateBundleManifests(bundleCount));
+            }
+        }
+
+        ~Population()
+        {
+            framework.Stop();
+            framework.WaitForStop(std::chrono::milliseconds::zero());
+        }
+
+        /*
+         * Returns a different number on each call, so that concurrent threads
+         * work on different items of the population.
+         */
+        std::size_t
+        Next()
+        {
+            return next.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Framework framework;
+        std::vector<ServiceRegistration<ScaleService>> registrations;
+        std::vector<Bundle> bundles;
+        std::atomic<uint64_t> deliveries;
+        std::atomic<std::size_t> next;
+    };
+
+    /*
+     * Returns the population of the current benchmark run. Populations are
+     * expensive to build, so the last one is kept for the runs with other
+     * thread counts.
+     */
+    std::shared_ptr<Population>
+    GetPopulation(int64_t services, int64_t listeners, int64_t bundles)
+    {
+        static std::mutex mutex;
+        static std::tuple<int64_t, int64_t, int64_t> key;
+        static std::shared_ptr<Population> population;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto const requested = std::make_tuple(services, listeners, bundles);
+        if (!population || key != requested)
+        {
+            population.reset();
+            population = std::make_shared<Population>(services, listeners, bundles);
+            key = requested;
+        }
+        return population;
+    }
+
+    void
+    ScalingArguments(benchmark::internal::Benchmark* b)
+    {
+        b->RangeMultiplier(10)->Range(100, 100000)->ThreadRange(1, 64)->UseRealTime();
+    }
+} // namespace
+
+/**
+ * Register a service, look it up by filter and unregister it again, while
+ * the framework holds a population of services of the same interface.
+ */
+static void
+ServiceChurn(benchmark::State& state)
+{
+    auto population = GetPopulation(state.range(0), 0, 0);
+    auto fc = population->framework.GetBundleContext();
+    auto const impl = std::make_shared<ScaleService>();
+
+    for (auto _ : state)
+    {
+        // negative, so that the filter never matches the population
+        auto const index = -1 - static_cast<int>(population->Next() % 1000000);
+        auto reg = fc.RegisterService<ScaleService>(impl,
+                                                    {
+                                                        {"scale.index", Any(index)}
+        });
+        auto refs = fc.GetServiceReferences<ScaleService>("(scale.index=" + std::to_string(index) + ")");
+        benchmark::DoNotOptimize(refs);
+        reg.Unregister();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["services"]
+        = benchmark::Counter(static_cast<double>(state.range(0)), benchmark::Counter::kAvgThreads);
+}
+
+BENCHMARK(ServiceChurn)->Apply(ScalingArguments);
+
+/**
+ * Look up the best service and one service by filter, and get the best
+ * service object.
+ */
+static void
+ServiceLookup(benchmark::State& state)
+{
+    auto population = GetPopulation(state.range(0), 0, 0);
+    auto fc = population->framework.GetBundleContext();
+    auto const size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        auto ref = fc.GetServiceReference<ScaleService>();
+        auto service = fc.GetService(ref);
+        benchmark::DoNotOptimize(service);
+        auto refs
+            = fc.GetServiceReferences<ScaleService>("(scale.index=" + std::to_string(population->Next() % size) + ")");
+        benchmark::DoNotOptimize(refs);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["services"]
+        = benchmark::Counter(static_cast<double>(state.range(0)), benchmark::Counter::kAvgThreads);
+}
+
+BENCHMARK(ServiceLookup)->Apply(ScalingArguments);
+
+/**
+ * Register and unregister a service which a population of service
+ * listeners is interested in. Each iteration delivers two events to every
+ * listener.
+ */
+static void
+ServiceEventStorm(benchmark::State& state)
+{
+    auto population = GetPopulation(0, state.range(0), 0);
+    auto fc = population->framework.GetBundleContext();
+    auto const impl = std::make_shared<StormService>();
+    auto const before = population->deliveries.load();
+
+    for (auto _ : state)
+    {
+        auto reg = fc.RegisterService<StormService>(impl);
+        reg.Unregister();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["listeners"]
+        = benchmark::Counter(static_cast<double>(state.range(0)), benchmark::Counter::kAvgThreads);
+    // every thread sees the deliveries of all threads
+    state.counters["deliveries"] = benchmark::Counter(static_cast<double>(population->deliveries.load() - before),
+                                                      benchmark::Counter::kAvgThreadsRate);
+}
+
+BENCHMARK(ServiceEventStorm)->Apply(ScalingArguments);
+
+/**
+ * Open and close a service tracker for a population of services.
+ */
+static void
+ServiceTrackerOpenClose(benchmark::State& state)
+{
+    auto population = GetPopulation(state.range(0), 0, 0);
+    auto fc = population->framework.GetBundleContext();
+
+    for (auto _ : state)
+    {
+        ServiceTracker<ScaleService> tracker(fc);
+        tracker.Open();
+        auto count = tracker.GetTrackingCount();
+        benchmark::DoNotOptimize(count);
+        tracker.Close();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["services"]
+        = benchmark::Counter(static_cast<double>(state.range(0)), benchmark::Counter::kAvgThreads);
+}
+
+BENCHMARK(ServiceTrackerOpenClose)->Apply(ScalingArguments);
+
+/**
+ * Start and stop bundles of a generated bundle population, and look them
+ * up by id.
+ */
+static void
+BundleLifecycle(benchmark::State& state)
+{
+    auto population = GetPopulation(0, 0, state.range(0));
+    auto fc = population->framework.GetBundleContext();
+    auto const size = population->bundles.size();
+
+    for (auto _ : state)
+    {
+        auto bundle = population->bundles[population->Next() % size];
+        bundle.Start();
+        auto found = fc.GetBundle(bundle.GetBundleId());
+        benchmark::DoNotOptimize(found);
+        bundle.Stop();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["bundles"]
+        = benchmark::Counter(static_cast<double>(size), benchmark::Counter::kAvgThreads);
+}
+
+BENCHMARK(BundleLifecycle)->Apply(ScalingArguments);
@@ -259,3 +259,107 @@ BENCHMARK_REGISTER_F(ServiceRegistryFixture, ModifyServices)
         {1, 1000}
 })
     ->UseManualTime();
+
+/**
+ * Change one counter property of a service with many properties, either by
+ * replacing all properties or by updating only the counter.
+ */
+static ServiceProperties
+MakePropertiesWithNKeys(int64_t keyCount)
+{
+    ServiceProperties props;
+    for (int64_t i = 0; i < keyCount; ++i)
+    {
+        props["perf.service.key" + std::to_string(i)] = std::string("value");
+    }
+    props["perf.service.counter"] = 0;
+    return props;
+}
+
+BENCHMARK_DEFINE_F(ServiceRegistryFixture, SetServiceCounterProperty)
+(benchmark::State& state)
+{
+    auto fc = framework->GetBundleContext();
+    auto props = MakePropertiesWithNKeys(state.range(0));
+    auto reg = fc.RegisterService<TestInterface>(std::make_shared<TestInterface>(), props);
+
+    int counter = 0;
+    for (auto _ : state)
+    {
+        props["perf.service.counter"] = ++counter;
+        reg.SetProperties(props);
+    }
+}
+
+BENCHMARK_REGISTER_F(ServiceRegistryFixture, SetServiceCounterProperty)->RangeMultiplier(10)->Range(1, 1000);
+
+BENCHMARK_DEFINE_F(ServiceRegistryFixture, UpdateServiceCounterProperty)
+(benchmark::State& state)
+{
+    auto fc = framework->GetBundleContext();
+    auto reg = fc.RegisterService<TestInterface>(std::make_shared<TestInterface>(),
+                                                 MakePropertiesWithNKeys(state.range(0)));
+
+    int counter = 0;
+    for (auto _ : state)
+    {
+        reg.UpdateProperties({ { "perf.service.counter", Any(++counter) } });
+    }
+}
+
+BENCHMARK_REGISTER_F(ServiceRegistryFixture, UpdateServiceCounterProperty)->RangeMultiplier(10)->Range(1, 1000);
+
+namespace
+{
+    /*
+     * A framework with one singleton service, shared by all benchmark threads.
+     */
+    struct SharedSingletonService
+    {
+        SharedSingletonService() : framework(FrameworkFactory().NewFramework())
+        {
+            framework.Start();
+            auto fc = framework.GetBundleContext();
+            reg = fc.RegisterService<TestInterface>(std::make_shared<TestInterface>());
+            ref = reg.GetReference();
+        }
+
+        ~SharedSingletonService()
+        {
+            framework.Stop();
+            framework.WaitForStop(std::chrono::milliseconds::zero());
+        }
+
+        Framework framework;
+        ServiceRegistration<TestInterface> reg;
+        ServiceReference<TestInterface> ref;
+    };
+
+    SharedSingletonService&
+    GetSharedSingletonService()
+    {
+        static SharedSingletonService shared;
+        return shared;
+    }
+} // namespace
+
+/**
+ * Get and release the same singleton service from an increasing number of
+ * threads. With uncontended use counting the throughput per thread should
+ * stay roughly flat.
+ */
+static void
+GetSingletonServiceConcurrently(benchmark::State& state)
+{
+    auto& shared = GetSharedSingletonService();
+    auto fc = shared.framework.GetBundleContext();
+
+    for (auto _ : state)
+    {
+        auto service = fc.GetService(shared.ref);
+        benchmark::DoNotOptimize(service);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(GetSingletonServiceConcurrently)->ThreadRange(1, 64)->UseRealTime();
@@ -8,6 +8,7 @@
 
 #include <chrono>
 #include <unordered_set>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 #include "fooservice.h"
@@ -201,6 +202,36 @@ BENCHMARK_DEFINE_F(ServiceTrackerFixture, ServiceTrackerScalabilityWithLDAPFilte
     }
 }
 
+/// Benchmark how long it takes to open a service tracker against many existing services
+BENCHMARK_DEFINE_F(ServiceTrackerFixture, OpenServiceTrackerWithExistingServices)
+(benchmark::State& state)
+{
+    using namespace std::chrono;
+    using namespace benchmark::test;
+    using namespace cppmicroservices;
+
+    auto fc = framework->GetBundleContext();
+    std::vector<ServiceRegistration<Foo>> registrations;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        registrations.push_back(fc.RegisterService<Foo>(
+            std::make_shared<FooImpl>(),
+            { { Constants::SERVICE_RANKING, Any(static_cast<int>(i % 7)) } }));
+    }
+
+    ServiceTracker<Foo> fooTracker(fc);
+    for (auto _ : state)
+    {
+        auto start = high_resolution_clock::now();
+        fooTracker.Open();
+        auto end = high_resolution_clock::now();
+        auto elapsed_seconds = duration_cast<duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+
+        fooTracker.Close();
+    }
+}
+
 static void
 CloseServiceTracker(benchmark::State& state)
 {
@@ -237,6 +268,11 @@ CloseServiceTracker(benchmark::State& state)
 BENCHMARK_REGISTER_F(ServiceTrackerFixture, OpenServiceTrackerWithSvcRef)->UseManualTime();
 BENCHMARK_REGISTER_F(ServiceTrackerFixture, OpenServiceTrackerWithBundleContext)->UseManualTime();
 BENCHMARK_REGISTER_F(ServiceTrackerFixture, OpenServiceTrackerWithInterfaceName)->UseManualTime();
+BENCHMARK_REGISTER_F(ServiceTrackerFixture, OpenServiceTrackerWithExistingServices)
+    ->Arg(1)
+    ->Arg(1000)
+    ->Arg(20000)
+    ->UseManualTime();
 BENCHMARK(CloseServiceTracker)->RangeMultiplier(2)->Range(1000, 1000000);
 
 // Run this benchmark for each Arg(...) call, passing in the parameter value to the benchmark.
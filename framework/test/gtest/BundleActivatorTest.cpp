@@ -26,12 +26,15 @@
 #include "cppmicroservices/Framework.h"
 #include "cppmicroservices/FrameworkEvent.h"
 #include "cppmicroservices/FrameworkFactory.h"
+#include "cppmicroservices/ServiceFactory.h"
 
 #include "TestUtilBundleListener.h"
 #include "TestUtils.h"
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 US_MSVC_PUSH_DISABLE_WARNING(4996)
 
 using namespace cppmicroservices;
@@ -151,4 +154,168 @@ TEST_F(BundleActivatorTest, PropertyTrueWithClass)
     EXPECT_TRUE(ref);
 }
 
+namespace
+{
+    struct LazyTrigger
+    {
+        virtual ~LazyTrigger() = default;
+    };
+
+    struct LazyTriggerImpl : LazyTrigger
+    {
+    };
+
+    class LazyTriggerFactory : public ServiceFactory
+    {
+      public:
+        InterfaceMapConstPtr
+        GetService(Bundle const&, ServiceRegistrationBase const&) override
+        {
+            return MakeInterfaceMap<LazyTrigger>(std::make_shared<LazyTriggerImpl>());
+        }
+
+        void
+        UngetService(Bundle const&, ServiceRegistrationBase const&, InterfaceMapConstPtr const&) override
+        {
+        }
+    };
+} // namespace
+
+// bundle.activation_policy set to lazy and the bundle is started with START_ACTIVATION_POLICY
+TEST_F(BundleActivatorTest, LazyActivationPolicy)
+{
+    auto bundle = cppmicroservices::testing::InstallLib(ctx, "TestBundleBA_L1");
+    ASSERT_TRUE(bundle);
+
+    std::vector<BundleEvent::Type> events;
+    auto token = ctx.AddBundleListener(
+        [&](BundleEvent const& evt)
+        {
+            if (evt.GetBundle() == bundle)
+            {
+                events.push_back(evt.GetType());
+            }
+        });
+
+    EXPECT_NO_THROW(bundle.Start(Bundle::START_ACTIVATION_POLICY));
+    EXPECT_EQ(Bundle::STATE_STARTING, bundle.GetState());
+    std::vector<BundleEvent::Type> const expected = { BundleEvent::BUNDLE_RESOLVED,
+                                                      BundleEvent::BUNDLE_LAZY_ACTIVATION };
+    EXPECT_EQ(expected, events);
+    events.clear();
+
+    // starting again according to the activation policy does nothing
+    EXPECT_NO_THROW(bundle.Start(Bundle::START_ACTIVATION_POLICY));
+    EXPECT_TRUE(events.empty());
+
+    // verify bundle activator was not called yet => service not registered
+    auto bundleCtx = bundle.GetBundleContext();
+    EXPECT_FALSE(bundleCtx.GetServiceReference("cppmicroservices::TestBundleBA_L1Service"));
+
+    // getting a service registered with the bundle's context activates the bundle
+    auto reg = bundleCtx.RegisterService<LazyTrigger>(ToFactory(std::make_shared<LazyTriggerFactory>()));
+    auto triggerRef = ctx.GetServiceReference<LazyTrigger>();
+    ASSERT_TRUE(triggerRef);
+    EXPECT_TRUE(ctx.GetService(triggerRef));
+    ctx.RemoveListener(std::move(token));
+    EXPECT_EQ(Bundle::STATE_ACTIVE, bundle.GetState());
+    std::vector<BundleEvent::Type> const activated = { BundleEvent::BUNDLE_STARTING, BundleEvent::BUNDLE_STARTED };
+    EXPECT_EQ(activated, events);
+    EXPECT_TRUE(bundleCtx.GetServiceReference("cppmicroservices::TestBundleBA_L1Service"));
+
+    // stopping the bundle calls the activator's Stop
+    bundle.Stop();
+    EXPECT_FALSE(ctx.GetServiceReference("cppmicroservices::TestBundleBA_L1Service"));
+}
+
+// bundle.activation_policy set to lazy and the bundle is started eagerly
+TEST_F(BundleActivatorTest, LazyActivationPolicyNotRequested)
+{
+    auto bundle = cppmicroservices::testing::InstallLib(ctx, "TestBundleBA_L1");
+    ASSERT_TRUE(bundle);
+    EXPECT_NO_THROW(bundle.Start());
+    EXPECT_TRUE(bundle.GetBundleContext().GetServiceReference("cppmicroservices::TestBundleBA_L1Service"));
+}
+
+// a bundle waiting for lazy activation is activated by a start without the activation policy
+TEST_F(BundleActivatorTest, LazyActivationPolicyThenEagerStart)
+{
+    auto bundle = cppmicroservices::testing::InstallLib(ctx, "TestBundleBA_L1");
+    ASSERT_TRUE(bundle);
+    EXPECT_NO_THROW(bundle.Start(Bundle::START_ACTIVATION_POLICY));
+    EXPECT_EQ(Bundle::STATE_STARTING, bundle.GetState());
+
+    EXPECT_NO_THROW(bundle.Start());
+    EXPECT_EQ(Bundle::STATE_ACTIVE, bundle.GetState());
+    EXPECT_TRUE(bundle.GetBundleContext().GetServiceReference("cppmicroservices::TestBundleBA_L1Service"));
+}
+
+// the activator of a lazily activated bundle stops its own bundle
+TEST_F(BundleActivatorTest, LazyActivatorStopsOwnBundle)
+{
+    auto bundle = cppmicroservices::testing::InstallLib(ctx, "TestBundleBA_L2");
+    ASSERT_TRUE(bundle);
+    EXPECT_NO_THROW(bundle.Start(Bundle::START_ACTIVATION_POLICY));
+    EXPECT_EQ(Bundle::STATE_STARTING, bundle.GetState());
+
+    std::vector<BundleEvent::Type> events;
+    auto token = ctx.AddBundleListener(
+        [&](BundleEvent const& evt)
+        {
+            if (evt.GetBundle() == bundle)
+            {
+                events.push_back(evt.GetType());
+            }
+        });
+    bool frameworkError = false;
+    auto fwToken = ctx.AddFrameworkListener(
+        [&](FrameworkEvent const& evt)
+        {
+            if (evt.GetType() == FrameworkEvent::Type::FRAMEWORK_ERROR)
+            {
+                frameworkError = true;
+            }
+        });
+
+    auto reg = bundle.GetBundleContext().RegisterService<LazyTrigger>(
+        ToFactory(std::make_shared<LazyTriggerFactory>()));
+    auto triggerRef = ctx.GetServiceReference<LazyTrigger>();
+    ASSERT_TRUE(triggerRef);
+    ctx.GetService(triggerRef);
+    ctx.RemoveListener(std::move(token));
+    ctx.RemoveListener(std::move(fwToken));
+
+    EXPECT_FALSE(frameworkError);
+    EXPECT_EQ(Bundle::STATE_RESOLVED, bundle.GetState());
+    std::vector<BundleEvent::Type> const expected = { BundleEvent::BUNDLE_STARTING,
+                                                      BundleEvent::BUNDLE_STARTED,
+                                                      BundleEvent::BUNDLE_STOPPING,
+                                                      BundleEvent::BUNDLE_STOPPED };
+    EXPECT_EQ(expected, events);
+}
+
+// bundle.activation_policy set to lazy and lazy activation enabled for the whole framework
+TEST(BundleActivatorLazyTest, FrameworkLazyActivationProperty)
+{
+    FrameworkConfiguration configuration { { Constants::FRAMEWORK_BUNDLE_LAZY_ACTIVATION, true } };
+    auto f = FrameworkFactory().NewFramework(configuration);
+    f.Start();
+    auto ctx = f.GetBundleContext();
+
+    auto bundle = cppmicroservices::testing::InstallLib(ctx, "TestBundleBA_L1");
+    ASSERT_TRUE(bundle);
+    EXPECT_NO_THROW(bundle.Start());
+    EXPECT_EQ(Bundle::STATE_STARTING, bundle.GetState());
+    EXPECT_FALSE(ctx.GetServiceReference("cppmicroservices::TestBundleBA_L1Service"));
+
+    // bundles without a lazy activation policy are still activated eagerly
+    auto eager = cppmicroservices::testing::InstallLib(ctx, "TestBundleA");
+    ASSERT_TRUE(eager);
+    EXPECT_NO_THROW(eager.Start());
+    EXPECT_TRUE(ctx.GetServiceReference("cppmicroservices::TestBundleAService"));
+
+    f.Stop();
+    f.WaitForStop(std::chrono::milliseconds::zero());
+}
+
 US_MSVC_POP_WARNING
@@ -29,7 +29,12 @@ limitations under the License.
 #include "cppmicroservices/FrameworkFactory.h"
 
 #include "gtest/gtest.h"
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 using namespace cppmicroservices;
 
@@ -434,6 +439,158 @@ TEST_F(BundleResourceTest, testCompressedResource)
     ASSERT_TRUE(bmp.eof());
 }
 
+TEST_F(BundleResourceTest, testBinaryResourceBulkRead)
+{
+    BundleResource res = testBundle.GetResource("/icons/compressable.bmp");
+    BundleResourceStream rs(res, std::ios_base::binary);
+
+    // the complete resource is reported as available
+    ASSERT_EQ(rs.rdbuf()->in_avail(), res.GetSize());
+
+    std::ostringstream out;
+    out << rs.rdbuf();
+    ASSERT_EQ(out.str().size(), static_cast<std::size_t>(res.GetSize()));
+
+    std::ifstream bmp(US_FRAMEWORK_SOURCE_DIR "/test/bundles/libRWithResources/resources/icons/compressable.bmp",
+                      std::ifstream::in | std::ifstream::binary);
+    ASSERT_TRUE(bmp.is_open());
+    std::ostringstream expected;
+    expected << bmp.rdbuf();
+    ASSERT_EQ(out.str(), expected.str());
+
+    // seeking relative to the current position and past the end
+    rs.clear();
+    rs.seekg(10);
+    rs.seekg(5, std::ios_base::cur);
+    ASSERT_EQ(rs.tellg(), std::streampos(15));
+    ASSERT_EQ(rs.get(), static_cast<unsigned char>(expected.str()[15]));
+    rs.seekg(1, std::ios_base::end);
+    ASSERT_TRUE(rs.fail());
+}
+
+TEST_F(BundleResourceTest, testStreamedResourceSeek)
+{
+    // large enough to be inflated incrementally instead of all at once
+    BundleResource res = testBundle.GetResource("/icons/compressable.bmp");
+    BundleResourceStream rs(res, std::ios_base::binary);
+
+    std::ifstream bmp(US_FRAMEWORK_SOURCE_DIR "/test/bundles/libRWithResources/resources/icons/compressable.bmp",
+                      std::ifstream::in | std::ifstream::binary);
+    ASSERT_TRUE(bmp.is_open());
+    std::ostringstream expectedStream;
+    expectedStream << bmp.rdbuf();
+    std::string const expected = expectedStream.str();
+    ASSERT_EQ(expected.size(), static_cast<std::size_t>(res.GetSize()));
+
+    // forward and backward seeks, within and outside of the current window
+    for (std::streamoff pos : { 0, 100, 200000, 150000, 150010, 70000, 299000, 10 })
+    {
+        rs.seekg(pos);
+        ASSERT_EQ(rs.tellg(), std::streampos(pos));
+        char buf[1000];
+        rs.read(buf, sizeof(buf));
+        ASSERT_EQ(rs.gcount(), static_cast<std::streamsize>(sizeof(buf))) << "at " << pos;
+        ASSERT_EQ(std::string(buf, sizeof(buf)), expected.substr(static_cast<std::size_t>(pos), sizeof(buf)))
+            << "at " << pos;
+    }
+
+    rs.seekg(-1, std::ios_base::end);
+    ASSERT_EQ(rs.get(), static_cast<unsigned char>(expected.back()));
+    ASSERT_EQ(rs.get(), std::char_traits<char>::eof());
+}
+
+TEST_F(BundleResourceTest, testStoredResourceSeek)
+{
+    // a stored copy of compressable.bmp, read from the archive without inflating
+    auto testBundleRA = cppmicroservices::testing::InstallLib(context, "TestBundleRA");
+    BundleResource res = testBundleRA.GetResource("/stored.bmp");
+    ASSERT_TRUE(res.IsValid());
+    ASSERT_EQ(res.GetCompressedSize(), res.GetSize());
+    BundleResourceStream rs(res, std::ios_base::binary);
+
+    std::ifstream bmp(US_FRAMEWORK_SOURCE_DIR "/test/bundles/libRWithResources/resources/icons/compressable.bmp",
+                      std::ifstream::in | std::ifstream::binary);
+    ASSERT_TRUE(bmp.is_open());
+    std::ostringstream expectedStream;
+    expectedStream << bmp.rdbuf();
+    std::string const expected = expectedStream.str();
+    ASSERT_EQ(expected.size(), static_cast<std::size_t>(res.GetSize()));
+
+    // forward and backward seeks, within and outside of the current window
+    for (std::streamoff pos : { 250000, 100, 200000, 150000, 150010, 70000, 299000, 0, 10 })
+    {
+        rs.seekg(pos);
+        ASSERT_EQ(rs.tellg(), std::streampos(pos));
+        char buf[1000];
+        rs.read(buf, sizeof(buf));
+        ASSERT_EQ(rs.gcount(), static_cast<std::streamsize>(sizeof(buf))) << "at " << pos;
+        ASSERT_EQ(std::string(buf, sizeof(buf)), expected.substr(static_cast<std::size_t>(pos), sizeof(buf)))
+            << "at " << pos;
+    }
+
+    rs.seekg(-1, std::ios_base::end);
+    ASSERT_EQ(rs.get(), static_cast<unsigned char>(expected.back()));
+    ASSERT_EQ(rs.get(), std::char_traits<char>::eof());
+
+    // reading the rest after a backward seek returns all remaining data
+    rs.clear();
+    rs.seekg(1000);
+    std::ostringstream rest;
+    rest << rs.rdbuf();
+    ASSERT_EQ(rest.str(), expected.substr(1000));
+}
+
+TEST_F(BundleResourceTest, testConcurrentResourceReads)
+{
+    // png data does not get smaller when compressed, so the resource
+    // compiler stores it uncompressed
+    BundleResource png = testBundle.GetResource("/icons/cppmicroservices.png");
+    BundleResource bmp = testBundle.GetResource("/icons/compressable.bmp");
+    ASSERT_EQ(png.GetCompressedSize(), png.GetSize());
+    ASSERT_LT(bmp.GetCompressedSize(), bmp.GetSize());
+
+    auto readFile = [](std::string const& path)
+    {
+        std::ifstream file(path, std::ifstream::in | std::ifstream::binary);
+        std::ostringstream content;
+        content << file.rdbuf();
+        return content.str();
+    };
+    std::string const expectedPng
+        = readFile(US_FRAMEWORK_SOURCE_DIR "/test/bundles/libRWithResources/resources/icons/cppmicroservices.png");
+    std::string const expectedBmp
+        = readFile(US_FRAMEWORK_SOURCE_DIR "/test/bundles/libRWithResources/resources/icons/compressable.bmp");
+
+    std::atomic<int> mismatches(0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                for (int j = 0; j < 5; ++j)
+                {
+                    // streams which are not binary read the whole resource at once
+                    BundleResourceStream pngStream(png);
+                    BundleResourceStream bmpStream(bmp);
+                    std::string pngData(expectedPng.size(), '\0');
+                    std::string bmpData(expectedBmp.size(), '\0');
+                    pngStream.read(&pngData[0], pngData.size());
+                    bmpStream.read(&bmpData[0], bmpData.size());
+                    if (pngData != expectedPng || bmpData != expectedBmp)
+                    {
+                        ++mismatches;
+                    }
+                }
+            });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    ASSERT_EQ(mismatches, 0);
+}
+
 TEST_F(BundleResourceTest, testResources)
 {
     BundleResource foo = testBundle.GetResource("foo.ptxt");
@@ -682,3 +682,133 @@ TEST_F(BundleTrackerCustomCallbackTest, ErrorInRemovedBundlePropagates)
   bundleTracker.Close();
   framework.GetBundleContext().RemoveListener(std::move(token));
 }
+
+//
+// Test batching through a customizer recording
+// each BundlesChanged call
+//
+class BatchCustomizer : public MockCustomizer
+{
+public:
+  std::vector<std::optional<Bundle>> BundlesChanged(
+    const BundleTrackerChanges<>& changes) override
+  {
+    batches.push_back(changes);
+    std::vector<std::optional<Bundle>> objects;
+    for (const auto& event : changes.adding) {
+      objects.emplace_back(event.GetBundle());
+    }
+    return objects;
+  }
+
+  std::vector<BundleTrackerChanges<>> batches;
+};
+
+TEST_F(BundleTrackerCustomCallbackTest, BatchCoalescesEventsIntoSingleCall)
+{
+  // Given an open BundleTracker tracking active bundles
+  auto stateMask =
+    BundleTracker<>::CreateStateMask(Bundle::State::STATE_ACTIVE);
+  auto customizer = std::make_shared<BatchCustomizer>();
+  auto bundleTracker = BundleTracker<>(context, stateMask, customizer);
+  EXPECT_CALL(*customizer, AddingBundle)
+    .WillRepeatedly(::testing::Return(std::nullopt));
+  bundleTracker.Open();
+
+  // When bundles change state several times within a batch
+  EXPECT_CALL(*customizer, AddingBundle).Times(0);
+  EXPECT_CALL(*customizer, ModifiedBundle).Times(0);
+  EXPECT_CALL(*customizer, RemovedBundle).Times(0);
+  bundleTracker.BeginBatch();
+  Bundle bundleA = cppmicroservices::testing::InstallLib(
+    framework.GetBundleContext(), "TestBundleA");
+  bundleA.Start();
+  Bundle bundleB = cppmicroservices::testing::InstallLib(
+    framework.GetBundleContext(), "TestBundleB");
+  bundleB.Start();
+  bundleB.Stop();
+
+  // Then no customizer is called until the batch ends
+  EXPECT_TRUE(customizer->batches.empty());
+  EXPECT_TRUE(bundleTracker.IsEmpty());
+  bundleTracker.EndBatch();
+
+  // And a single call adds the bundles in a tracked final state
+  ASSERT_EQ(1, customizer->batches.size());
+  const auto& added = customizer->batches[0];
+  ASSERT_EQ(1, added.adding.size());
+  EXPECT_EQ(bundleA, added.adding[0].GetBundle());
+  EXPECT_EQ(BundleEvent::BUNDLE_STARTED, added.adding[0].GetType())
+    << "The batch should carry the last event of the bundle";
+  EXPECT_TRUE(added.modified.empty());
+  EXPECT_TRUE(added.removed.empty());
+  EXPECT_EQ(bundleA, bundleTracker.GetObject(bundleA));
+
+  // When a tracked bundle leaves the state mask within a batch
+  bundleTracker.BeginBatch();
+  bundleA.Stop();
+  bundleTracker.EndBatch();
+
+  // Then it is removed by the next batch call
+  ASSERT_EQ(2, customizer->batches.size());
+  const auto& removed = customizer->batches[1];
+  EXPECT_TRUE(removed.adding.empty());
+  ASSERT_EQ(1, removed.removed.size());
+  EXPECT_EQ(bundleA, removed.removed[0].first.GetBundle());
+  EXPECT_EQ(bundleA, removed.removed[0].second);
+  EXPECT_TRUE(bundleTracker.IsEmpty());
+
+  bundleTracker.Close();
+}
+
+TEST_F(BundleTrackerCustomCallbackTest, NestedBatchesFlushOnOutermostEnd)
+{
+  auto customizer = std::make_shared<BatchCustomizer>();
+  auto bundleTracker = BundleTracker<>(context, all_states, customizer);
+  EXPECT_CALL(*customizer, AddingBundle)
+    .WillRepeatedly(::testing::Return(std::nullopt));
+  bundleTracker.Open();
+
+  bundleTracker.BeginBatch();
+  bundleTracker.BeginBatch();
+  Bundle bundleA = cppmicroservices::testing::InstallLib(
+    framework.GetBundleContext(), "TestBundleA");
+  bundleTracker.EndBatch();
+  EXPECT_TRUE(customizer->batches.empty())
+    << "An inner EndBatch() should not flush the batch";
+  bundleTracker.EndBatch();
+  ASSERT_EQ(1, customizer->batches.size());
+  EXPECT_EQ(1, customizer->batches[0].adding.size());
+
+  EXPECT_THROW(bundleTracker.EndBatch(), std::logic_error)
+    << "EndBatch() without BeginBatch() should throw";
+
+  EXPECT_CALL(*customizer, RemovedBundle).Times(::testing::AnyNumber());
+  bundleTracker.Close();
+}
+
+TEST_F(BundleTrackerCustomCallbackTest, DefaultBatchCallsSingleCallbacks)
+{
+  // Given a customizer which does not override BundlesChanged
+  auto customizer = std::make_shared<MockCustomizer>();
+  auto stateMask =
+    BundleTracker<>::CreateStateMask(Bundle::State::STATE_ACTIVE);
+  auto bundleTracker = BundleTracker<>(context, stateMask, customizer);
+  EXPECT_CALL(*customizer, AddingBundle)
+    .WillRepeatedly(::testing::Return(std::nullopt));
+  bundleTracker.Open();
+
+  // Then each coalesced bundle gets a single AddingBundle call
+  EXPECT_CALL(*customizer, AddingBundle)
+    .Times(1)
+    .WillOnce(::testing::ReturnArg<0>());
+  bundleTracker.BeginBatch();
+  Bundle bundleA = cppmicroservices::testing::InstallLib(
+    framework.GetBundleContext(), "TestBundleA");
+  bundleA.Start();
+  bundleTracker.EndBatch();
+  EXPECT_EQ(bundleA, bundleTracker.GetObject(bundleA));
+
+  EXPECT_CALL(*customizer, RemovedBundle).Times(1);
+  bundleTracker.Close();
+}
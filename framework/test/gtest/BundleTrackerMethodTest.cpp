@@ -153,6 +153,29 @@ TEST_F(BundleTrackerMethodTest, TestGetTracked)
     EXPECT_EQ(0, tracked.size()) << "GetTracked() should return an empty map after Close()";
 }
 
+TEST_F(BundleTrackerMethodTest, TestGetTrackedSnapshot)
+{
+    BundleTracker<> bundleTracker(context, all_states);
+    EXPECT_TRUE(bundleTracker.GetTrackedSnapshot()->empty())
+        << "GetTrackedSnapshot() should return an empty map before Open()";
+
+    ASSERT_NO_THROW(bundleTracker.Open()) << "BundleTracker failed to start";
+    auto snapshot = bundleTracker.GetTrackedSnapshot();
+    EXPECT_EQ(snapshot, bundleTracker.GetTrackedSnapshot())
+        << "An unchanged BundleTracker should share its snapshot";
+    EXPECT_EQ(bundleTracker.Size(), snapshot->size());
+
+    Bundle bundleA = cppmicroservices::testing::InstallLib(framework.GetBundleContext(), "TestBundleA");
+    auto updated = bundleTracker.GetTrackedSnapshot();
+    EXPECT_NE(snapshot, updated) << "Tracking a bundle should publish a new snapshot";
+    EXPECT_EQ(snapshot->end(), snapshot->find(bundleA)) << "A published snapshot should not change";
+    EXPECT_NE(updated->end(), updated->find(bundleA)) << "The new snapshot should include the test bundle";
+
+    bundleTracker.Close();
+    EXPECT_TRUE(bundleTracker.GetTrackedSnapshot()->empty())
+        << "GetTrackedSnapshot() should return an empty map after Close()";
+}
+
 TEST_F(BundleTrackerMethodTest, TestIsEmpty)
 {
     BundleTracker<> bundleTracker(context, all_states);
@@ -84,6 +84,31 @@ TEST(BundleValidationTest, BundleValidationSuccess)
     f.WaitForStop(std::chrono::milliseconds::zero());
 }
 
+TEST(BundleValidationTest, BundleValidationFailureWithLibraryPreload)
+{
+    using validationFuncType = std::function<bool(cppmicroservices::Bundle const&)>;
+
+    validationFuncType validationFunc = [](cppmicroservices::Bundle const&) -> bool { return false; };
+    cppmicroservices::FrameworkConfiguration configuration {
+        {cppmicroservices::Constants::FRAMEWORK_BUNDLE_VALIDATION_FUNC, validationFunc},
+        {cppmicroservices::Constants::FRAMEWORK_BUNDLE_LIBRARY_PRELOAD,
+         cppmicroservices::Constants::FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_LOAD}
+    };
+
+    auto f = cppmicroservices::FrameworkFactory().NewFramework(std::move(configuration));
+    ASSERT_NO_THROW(f.Start());
+
+    auto bundleA = cppmicroservices::testing::InstallLib(f.GetBundleContext(), "TestBundleA");
+    ASSERT_TRUE(bundleA);
+
+    // preloading must not bypass the bundle validation function.
+    ASSERT_THROW(bundleA.Start(), cppmicroservices::SecurityException);
+    ASSERT_EQ(bundleA.GetState(), cppmicroservices::Bundle::State::STATE_RESOLVED);
+
+    f.Stop();
+    f.WaitForStop(std::chrono::milliseconds::zero());
+}
+
 TEST(BundleValidationTest, BundleValidationFunctionException)
 {
     using validationFuncType = std::function<bool(cppmicroservices::Bundle const&)>;
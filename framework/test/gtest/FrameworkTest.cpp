@@ -23,6 +23,7 @@ limitations under the License.
 #include <chrono>
 #include <fstream>
 #include <mutex>
+#include <sstream>
 #include <thread>
 #include <type_traits>
 
@@ -36,6 +37,7 @@ limitations under the License.
 #include "cppmicroservices/FrameworkEvent.h"
 #include "cppmicroservices/FrameworkFactory.h"
 #include "cppmicroservices/SecurityException.h"
+#include "cppmicroservices/detail/Trace.h"
 #include "cppmicroservices/logservice/LogService.hpp"
 #include "cppmicroservices/util/FileSystem.h"
 
@@ -842,6 +844,132 @@ TEST(FrameworkTest, LoadLibraryLogsMessagesTest)
     f.Stop();
     f.WaitForStop(std::chrono::milliseconds::zero());
 }
+
+TEST(FrameworkTest, BundleLibraryPreload)
+{
+    for (auto const& preload : { Constants::FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_PREFETCH,
+                                 Constants::FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_LOAD,
+                                 std::string("unknown") })
+    {
+        FrameworkConfiguration configuration {
+            {Constants::FRAMEWORK_BUNDLE_LIBRARY_PRELOAD, preload}
+        };
+        auto f = FrameworkFactory().NewFramework(std::move(configuration));
+        ASSERT_TRUE(f);
+        f.Start();
+
+        auto context = f.GetBundleContext();
+        ASSERT_EQ(preload, any_cast<std::string>(context.GetProperty(Constants::FRAMEWORK_BUNDLE_LIBRARY_PRELOAD)));
+
+        auto bundle = cppmicroservices::testing::InstallLib(context, "TestBundleA");
+        ASSERT_TRUE(bundle);
+        ASSERT_NO_THROW(bundle.Start()) << "preload: " << preload;
+        ASSERT_EQ(Bundle::STATE_ACTIVE, bundle.GetState());
+        ASSERT_TRUE(context.GetServiceReference("cppmicroservices::TestBundleAService"));
+
+        // Restarting reuses the already resolved activator symbols.
+        bundle.Stop();
+        ASSERT_NO_THROW(bundle.Start());
+        ASSERT_EQ(Bundle::STATE_ACTIVE, bundle.GetState());
+
+        f.Stop();
+        f.WaitForStop(std::chrono::milliseconds::zero());
+    }
+}
+
+TEST(FrameworkTest, BundleLibraryPreloadManyBundles)
+{
+    // more bundles than preload threads, so preloads queue up
+    FrameworkConfiguration configuration {
+        {Constants::FRAMEWORK_BUNDLE_LIBRARY_PRELOAD, Constants::FRAMEWORK_BUNDLE_LIBRARY_PRELOAD_LOAD}
+    };
+    auto f = FrameworkFactory().NewFramework(std::move(configuration));
+    f.Start();
+    auto context = f.GetBundleContext();
+
+    std::vector<Bundle> bundles;
+    for (auto const& name : { "TestBundleA",
+                              "TestBundleA2",
+                              "TestBundleC1",
+                              "TestBundleH",
+                              "TestBundleM",
+                              "TestBundleS",
+                              "TestBundleSL1",
+                              "TestBundleSL3",
+                              "TestBundleSL4" })
+    {
+        bundles.push_back(cppmicroservices::testing::InstallLib(context, name));
+        ASSERT_TRUE(bundles.back()) << name;
+    }
+
+    for (auto& bundle : bundles)
+    {
+        if (bundle.GetSymbolicName() == "TestBundleA" || bundle.GetSymbolicName() == "TestBundleA2")
+        {
+            ASSERT_NO_THROW(bundle.Start()) << bundle.GetSymbolicName();
+            ASSERT_EQ(Bundle::STATE_ACTIVE, bundle.GetState());
+        }
+    }
+
+    // preloads of bundles which are never started are waited for on shutdown
+    f.Stop();
+    f.WaitForStop(std::chrono::milliseconds::zero());
+}
+
+TEST(FrameworkTest, StartupTraceFile)
+{
+    TempDir traceDir = MakeUniqueTempDirectory();
+    auto const traceFile = traceDir.Path + util::DIR_SEP + "startup.json";
+
+    FrameworkConfiguration configuration {
+        {Constants::FRAMEWORK_TRACE_FILE, traceFile}
+    };
+    auto f = FrameworkFactory().NewFramework(std::move(configuration));
+    ASSERT_TRUE(f);
+    f.Start();
+
+    auto bundle = cppmicroservices::testing::InstallLib(f.GetBundleContext(), "TestBundleA");
+    ASSERT_TRUE(bundle);
+    bundle.Start();
+
+    f.Stop();
+    f.WaitForStop(std::chrono::milliseconds::zero());
+
+    std::ifstream traceStream(traceFile);
+    ASSERT_TRUE(traceStream.is_open());
+    std::string const trace { std::istreambuf_iterator<char>(traceStream), std::istreambuf_iterator<char>() };
+    EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"InstallBundle\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"StartBundle\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"BundleActivator::Start\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"ServiceChanged\""));
+    EXPECT_NE(std::string::npos, trace.find("\"detail\":\"TestBundleA\""));
+    EXPECT_NE(std::string::npos, trace.find("\"droppedSpans\":0"));
+}
+
+TEST(FrameworkTest, TraceBufferIsBounded)
+{
+    detail::Tracer::Enable();
+    auto const now = detail::Tracer::Clock::now();
+    for (std::size_t i = 0; i < detail::Tracer::MAX_SPANS_PER_THREAD + 10; ++i)
+    {
+        detail::Tracer::Record("test", "Span", "", now, now);
+    }
+
+    std::ostringstream traceStream;
+    detail::Tracer::WriteChromeTrace(traceStream);
+    detail::Tracer::Disable();
+
+    std::string const trace = traceStream.str();
+    std::size_t spans = 0;
+    for (auto pos = trace.find("\"name\":\"Span\""); pos != std::string::npos;
+         pos = trace.find("\"name\":\"Span\"", pos + 1))
+    {
+        ++spans;
+    }
+    EXPECT_EQ(detail::Tracer::MAX_SPANS_PER_THREAD, spans);
+    EXPECT_NE(std::string::npos, trace.find("\"droppedSpans\":10"));
+}
 #endif
 
 US_MSVC_POP_WARNING
@@ -0,0 +1,192 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+  =============================================================================*/
+
+#include "cppmicroservices/BundleContext.h"
+#include "cppmicroservices/Constants.h"
+#include "cppmicroservices/Framework.h"
+#include "cppmicroservices/FrameworkEvent.h"
+#include "cppmicroservices/FrameworkFactory.h"
+#include "cppmicroservices/LockProfiler.h"
+#include "cppmicroservices/ServiceTracker.h"
+#include "cppmicroservices/detail/Threads.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <future>
+#include <numeric>
+#include <sstream>
+#include <thread>
+
+using namespace cppmicroservices;
+
+namespace
+{
+    struct ITestService
+    {
+        virtual ~ITestService() = default;
+    };
+
+    struct TestService : ITestService
+    {
+    };
+
+    LockSiteStatistics
+    FindSite(std::vector<LockSiteStatistics> const& stats, std::string const& name)
+    {
+        auto iter = std::find_if(stats.begin(),
+                                 stats.end(),
+                                 [&name](LockSiteStatistics const& s) { return s.name == name; });
+        return iter == stats.end() ? LockSiteStatistics() : *iter;
+    }
+
+    class LockProfilerTest : public ::testing::Test
+    {
+      protected:
+        void
+        SetUp() override
+        {
+            LockProfiler::Reset();
+        }
+
+        void
+        TearDown() override
+        {
+            LockProfiler::Reset();
+        }
+    };
+} // namespace
+
+TEST_F(LockProfilerTest, Percentile)
+{
+    std::vector<std::uint64_t> histogram { 0, 0, 3, 1 };
+    EXPECT_EQ(std::chrono::nanoseconds(4), LockProfiler::Percentile(histogram, 0.5));
+    EXPECT_EQ(std::chrono::nanoseconds(8), LockProfiler::Percentile(histogram, 0.99));
+    EXPECT_EQ(std::chrono::nanoseconds(0), LockProfiler::Percentile({ 0, 0 }, 0.5));
+}
+
+#ifdef US_ENABLE_THREADING_SUPPORT
+TEST_F(LockProfilerTest, FrameworkPropertyEnablesProfiling)
+{
+    ASSERT_FALSE(LockProfiler::IsEnabled());
+
+    auto f = FrameworkFactory().NewFramework(FrameworkConfiguration {
+        {Constants::FRAMEWORK_LOCK_PROFILING, true}
+    });
+    f.Start();
+    EXPECT_TRUE(LockProfiler::IsEnabled());
+
+    auto context = f.GetBundleContext();
+    ServiceTracker<ITestService> tracker(context);
+    tracker.Open();
+    for (int i = 0; i < 10; ++i)
+    {
+        context.RegisterService<ITestService>(std::make_shared<TestService>());
+    }
+    EXPECT_EQ(10u, tracker.GetServiceReferences().size());
+    tracker.Close();
+
+    f.Stop();
+    f.WaitForStop(std::chrono::milliseconds::zero());
+    EXPECT_FALSE(LockProfiler::IsEnabled());
+
+    // statistics are kept after profiling stopped
+    auto const stats = LockProfiler::GetStatistics();
+    for (auto const& name : { "ServiceRegistry", "ServiceListeners", "BundleRegistry", "ServiceHooks" })
+    {
+        auto const site = FindSite(stats, name);
+        EXPECT_GT(site.acquisitions, 0u) << name;
+        ASSERT_EQ(site.waitHistogram.size(), site.holdHistogram.size()) << name;
+        EXPECT_EQ(site.acquisitions,
+                  std::accumulate(site.waitHistogram.begin(), site.waitHistogram.end(), std::uint64_t(0)))
+            << name;
+        EXPECT_GE(site.totalHold, site.maxHold) << name;
+    }
+    // trackers are header only and keep no lock sites outside the framework
+    EXPECT_EQ(0u, FindSite(stats, "ServiceTracker").acquisitions);
+
+    std::ostringstream report;
+    LockProfiler::WriteReport(report);
+    EXPECT_NE(std::string::npos, report.str().find("ServiceRegistry"));
+
+    LockProfiler::Reset();
+    EXPECT_TRUE(LockProfiler::GetStatistics().empty());
+}
+
+TEST_F(LockProfilerTest, RecordsContention)
+{
+    struct Guarded : detail::MultiThreaded<>
+    {
+    } guarded;
+    detail::LockSite site("LockProfilerTest::Guarded");
+    guarded.SetLockSite(&site);
+
+    // not recorded while profiling is disabled
+    guarded.Lock();
+    EXPECT_EQ(0u, site.acquisitions.load());
+
+    LockProfiler::Enable();
+    std::promise<void> locked;
+    std::thread holder(
+        [&guarded, &locked]
+        {
+            auto l = guarded.Lock();
+            locked.set_value();
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        });
+    locked.get_future().wait();
+    {
+        auto l = guarded.Lock();
+    }
+    holder.join();
+    LockProfiler::Disable();
+
+    auto const stats = FindSite(LockProfiler::GetStatistics(), "LockProfilerTest::Guarded");
+    EXPECT_EQ(2u, stats.acquisitions);
+    EXPECT_EQ(1u, stats.contentions);
+    EXPECT_GT(stats.maxWait, std::chrono::milliseconds(1));
+    EXPECT_GE(stats.maxHold, std::chrono::milliseconds(50));
+
+    guarded.SetLockSite(nullptr);
+}
+
+TEST_F(LockProfilerTest, LockLayoutIndependentOfProfiling)
+{
+    // sites are assigned in a table inside the framework, not in the
+    // objects embedding a lock
+    static_assert(sizeof(detail::MutexLockingStrategy<>) == sizeof(std::mutex));
+    static_assert(sizeof(detail::MutexLockingStrategy<>::UniqueLock) == sizeof(std::unique_lock<std::mutex>));
+
+    struct Guarded : detail::MultiThreaded<>
+    {
+    } guarded;
+    detail::LockSite site("LockProfilerTest::Unassigned");
+    guarded.SetLockSite(&site);
+    guarded.SetLockSite(nullptr);
+
+    LockProfiler::Enable();
+    {
+        auto l = guarded.Lock();
+    }
+    LockProfiler::Disable();
+    EXPECT_EQ(0u, site.acquisitions.load());
+}
+#endif
@@ -497,6 +497,30 @@ TEST_F(MultipleListenersTest, testListenerTypes)
 #endif
 }
 
+// Bundle events are delivered from a shared listener snapshot; adding or
+// removing a listener between events must be visible to the next event.
+TEST_F(MultipleListenersTest, testBundleListenerChangesBetweenEvents)
+{
+    int countA = 0;
+    int countB = 0;
+    auto tokenA = fCtx.AddBundleListener([&countA](BundleEvent const&) { ++countA; });
+
+    auto bundle = cppmicroservices::testing::InstallLib(fCtx, "TestBundleA");
+    ASSERT_EQ(countA, 1); // INSTALLED
+
+    auto tokenB = fCtx.AddBundleListener([&countB](BundleEvent const&) { ++countB; });
+    bundle.Start();
+    ASSERT_EQ(countA, 4); // RESOLVED, STARTING, STARTED
+    ASSERT_EQ(countB, 3);
+
+    fCtx.RemoveListener(std::move(tokenA));
+    bundle.Stop();
+    ASSERT_EQ(countA, 4);
+    ASSERT_EQ(countB, 5); // STOPPING, STOPPED
+
+    fCtx.RemoveListener(std::move(tokenB));
+}
+
 #ifdef US_ENABLE_THREADING_SUPPORT
 // Test the addition of thousand listeners asynchronously.
 TEST_F(MultipleListenersTest, testConcurrentAdd)
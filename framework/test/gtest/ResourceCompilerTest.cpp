@@ -32,9 +32,12 @@
 #include <array>
 #include <cstdlib>
 #include <fstream>
+#include <map>
+#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 using namespace cppmicroservices;
 using namespace cppmicroservices::util;
@@ -329,6 +332,32 @@ namespace
         return std::string();
     }
 
+    // return the raw, possibly compressed, data of the given archive entry
+    std::string
+    getRawEntryData(std::string const& zipfile, std::string const& archiveEntry)
+    {
+        mz_zip_archive zipArchive;
+        memset(&zipArchive, 0, sizeof(mz_zip_archive));
+
+        EXPECT_TRUE(mz_zip_reader_init_file(&zipArchive, zipfile.c_str(), 0))
+            << "Could not initialize zip archive " << zipfile;
+
+        size_t length = 0;
+        void* data = mz_zip_reader_extract_file_to_heap(&zipArchive,
+                                                        archiveEntry.c_str(),
+                                                        &length,
+                                                        MZ_ZIP_FLAG_COMPRESSED_DATA);
+        std::string rawData;
+        if (data != nullptr)
+        {
+            rawData.assign(static_cast<char const*>(data), length);
+            mz_free(data);
+        }
+
+        mz_zip_reader_end(&zipArchive);
+        return rawData;
+    }
+
     /*
      * @brief remove any line feed and new line characters.
      * @param[in,out] str string to be modified
@@ -637,6 +666,157 @@ TEST_F(ResourceCompilerTest, testCompressionLevel)
     testExists(entryNames, "mybundle/resource2/");
 }
 
+/*
+ * Compress the same resources with one and with several threads. The archive
+ * entries must be identical, and resources with identical content must be
+ * compressed identically.
+ *
+ * Working directory is changed temporarily to tempdir because of --res-add option
+ */
+TEST_F(ResourceCompilerTest, testParallelCompression)
+{
+    std::string const resourceDir(tempdir + "parallel");
+    MakePath(resourceDir);
+    std::vector<std::string> resources;
+    for (int i = 0; i < 40; ++i)
+    {
+        std::string resource("parallel/resource" + std::to_string(i) + ".txt");
+        std::ofstream file(tempdir + resource);
+        ASSERT_TRUE(file.is_open()) << "Couldn't open " << resource;
+        // every other resource has the same content
+        for (int line = 0; line < 1000; ++line)
+        {
+            file << "line " << line << " of resource " << (i % 2 == 0 ? 0 : i) << "\n";
+        }
+        resources.push_back(resource);
+    }
+
+    auto compress = [&](std::string const& zipFile, int jobs)
+    {
+        std::ostringstream cmd;
+        cmd << rcbinpath;
+        cmd << " --bundle-name mybundle ";
+        cmd << " --out-file " << zipFile;
+        cmd << " --jobs " << jobs;
+        for (auto const& resource : resources)
+        {
+            cmd << " --res-add " << resource;
+        }
+
+        auto cwdir = util::GetCurrentWorkingDirectory();
+        ChangeDirectory(tempdir);
+        auto result = runExecutable(cmd.str());
+        ChangeDirectory(cwdir);
+        return result;
+    };
+
+    ASSERT_EQ(EXIT_SUCCESS, compress("ExampleParallel1.zip", 1));
+    ASSERT_EQ(EXIT_SUCCESS, compress("ExampleParallel4.zip", 4));
+
+    ZipFile zip1(tempdir + "ExampleParallel1.zip");
+    ZipFile zip4(tempdir + "ExampleParallel4.zip");
+    // the resources, mybundle/ and mybundle/parallel/
+    ASSERT_EQ(zip1.size(), resources.size() + 2);
+    ASSERT_EQ(zip1.getNames(), zip4.getNames());
+
+    for (ZipFile::size_type i = 0; i < zip1.size(); ++i)
+    {
+        ASSERT_EQ(zip1[i].compressedSize, zip4[i].compressedSize) << zip1[i].name;
+        ASSERT_EQ(zip1[i].uncompressedSize, zip4[i].uncompressedSize) << zip1[i].name;
+        ASSERT_EQ(zip1[i].crc32, zip4[i].crc32) << zip1[i].name;
+        ASSERT_EQ(getRawEntryData(tempdir + "ExampleParallel1.zip", zip1[i].name),
+                  getRawEntryData(tempdir + "ExampleParallel4.zip", zip4[i].name))
+            << zip1[i].name;
+    }
+
+    auto const resource0 = getRawEntryData(tempdir + "ExampleParallel4.zip", "mybundle/parallel/resource0.txt");
+    ASSERT_FALSE(resource0.empty());
+    ASSERT_EQ(resource0, getRawEntryData(tempdir + "ExampleParallel4.zip", "mybundle/parallel/resource2.txt"));
+    ASSERT_NE(resource0, getRawEntryData(tempdir + "ExampleParallel4.zip", "mybundle/parallel/resource1.txt"));
+}
+
+/*
+ * Use compression rules to store some resources uncompressed and to compress
+ * others with a different level. Resources which do not get smaller when
+ * compressed are stored regardless of the rules.
+ *
+ * Working directory is changed temporarily to tempdir because of --res-add option
+ */
+TEST_F(ResourceCompilerTest, testCompressionRules)
+{
+    std::string const resourceDir(tempdir + "rules");
+    MakePath(resourceDir);
+    for (auto const& name : { "image.png", "config.json", "readme.txt" })
+    {
+        std::ofstream file(resourceDir + DIR_SEP + name);
+        ASSERT_TRUE(file.is_open()) << "Couldn't open " << name;
+        for (int line = 0; line < 100; ++line)
+        {
+            file << "{ \"line\" : " << line << " }\n";
+        }
+    }
+    {
+        std::ofstream file(resourceDir + DIR_SEP + "random.bin", std::ios::binary);
+        ASSERT_TRUE(file.is_open()) << "Couldn't open random.bin";
+        std::mt19937 generator(42);
+        for (int i = 0; i < 4096; ++i)
+        {
+            file.put(static_cast<char>(generator() & 0xFF));
+        }
+    }
+
+    std::ostringstream cmd;
+    cmd << rcbinpath;
+    cmd << " --bundle-name mybundle ";
+    cmd << " --out-file ExampleCompressionRules.zip ";
+    cmd << " --compression-rule \"*.png=0\" ";
+    cmd << " --compression-rule \"rules/*.json=9\" ";
+    cmd << " --res-add rules/image.png";
+    cmd << " --res-add rules/config.json";
+    cmd << " --res-add rules/readme.txt";
+    cmd << " --res-add rules/random.bin";
+
+    auto cwdir = util::GetCurrentWorkingDirectory();
+    ChangeDirectory(tempdir);
+    ASSERT_EQ(EXIT_SUCCESS, runExecutable(cmd.str()));
+    ChangeDirectory(cwdir);
+
+    ZipFile zip(tempdir + "ExampleCompressionRules.zip");
+    std::map<std::string, EntryInfo> entries;
+    for (ZipFile::size_type i = 0; i < zip.size(); ++i)
+    {
+        entries[zip[i].name] = zip[i];
+    }
+
+    auto const& png = entries["mybundle/rules/image.png"];
+    ASSERT_EQ(0, png.method);
+    ASSERT_EQ(png.uncompressedSize, png.compressedSize);
+
+    auto const& json = entries["mybundle/rules/config.json"];
+    ASSERT_EQ(MZ_DEFLATED, json.method);
+    ASSERT_LT(json.compressedSize, json.uncompressedSize);
+
+    auto const& txt = entries["mybundle/rules/readme.txt"];
+    ASSERT_EQ(MZ_DEFLATED, txt.method);
+    ASSERT_LT(txt.compressedSize, txt.uncompressedSize);
+
+    auto const& random = entries["mybundle/rules/random.bin"];
+    ASSERT_EQ(0, random.method);
+    ASSERT_EQ(4096u, random.compressedSize);
+
+    // malformed rules and levels out of range are rejected
+    for (auto const& rule : { "*.png", "=0", "*.png=", "*.png=11", "*.png=-1", "*.png=fast" })
+    {
+        cmd.str(std::string());
+        cmd << rcbinpath;
+        cmd << " --bundle-name mybundle ";
+        cmd << " --out-file " << tempdir << "ExampleInvalidCompressionRule.zip ";
+        cmd << " --compression-rule \"" << rule << "\"";
+        cmd << " --res-add " << tempdir << "rules/readme.txt";
+        ASSERT_EQ(EXIT_FAILURE, runExecutable(cmd.str())) << rule;
+    }
+}
+
 /*
  * Add the same manifest contents multiples times through --manifest-add
  * The intended behavior is that any subsequent duplicate manifest file is ignored
@@ -30,6 +30,8 @@ limitations under the License.
 #include "cppmicroservices/GetBundleContext.h"
 #include "cppmicroservices/LDAPProp.h"
 #include "cppmicroservices/ListenerToken.h"
+#include "cppmicroservices/PrototypeServiceFactory.h"
+#include "cppmicroservices/PrototypeServiceInstancePool.h"
 #include "cppmicroservices/ServiceObjects.h"
 
 #include "cppmicroservices/detail/Threads.h"
@@ -84,6 +86,39 @@ namespace
         MOCK_METHOD3(UngetService, void(Bundle const&, ServiceRegistrationBase const&, InterfaceMapConstPtr const&));
     };
 
+    // Prototype factory recording the service objects it created and released
+    class RecordingPrototypeFactory
+        : public PrototypeServiceFactory
+        , public PrototypeServiceInstancePool
+    {
+      public:
+        explicit RecordingPrototypeFactory(std::size_t poolCapacity = 0) : poolCapacity(poolCapacity) {}
+
+        InterfaceMapConstPtr
+        GetService(Bundle const&, ServiceRegistrationBase const&) override
+        {
+            auto service = MakeInterfaceMap<ITestServiceA>(std::make_shared<TestServiceAImpl>());
+            created.push_back(service);
+            return service;
+        }
+
+        void
+        UngetService(Bundle const&, ServiceRegistrationBase const&, InterfaceMapConstPtr const& service) override
+        {
+            released.push_back(service);
+        }
+
+        std::size_t
+        GetInstancePoolCapacity() const override
+        {
+            return poolCapacity;
+        }
+
+        std::size_t const poolCapacity;
+        std::vector<InterfaceMapConstPtr> created;
+        std::vector<InterfaceMapConstPtr> released;
+    };
+
 } // namespace
 
 class ServiceFactoryTest : public ::testing::Test
@@ -572,3 +607,67 @@ TEST_F(ServiceFactoryTest, TestServiceFactoryBundleScopeErrorConditions)
     // Test that no FrameworkEvent was sent
     ASSERT_TRUE(fwEvents.empty());
 }
+
+TEST_F(ServiceFactoryTest, TestPrototypeServiceRelease)
+{
+    auto sf = std::make_shared<RecordingPrototypeFactory>();
+    auto reg = context.RegisterService<ITestServiceA>(ToFactory(sf));
+    auto objects = context.GetServiceObjects(reg.GetReference());
+
+    std::vector<std::shared_ptr<ITestServiceA>> services;
+    for (int i = 0; i < 100; ++i)
+    {
+        services.push_back(objects.GetService());
+    }
+    ASSERT_EQ(100u, sf->created.size());
+
+    // Release from the middle; each release ungets exactly that object.
+    auto const released = services[42].get();
+    services.erase(services.begin() + 42);
+    ASSERT_EQ(1u, sf->released.size());
+    ASSERT_EQ(released,
+              std::static_pointer_cast<ITestServiceA>(sf->released[0]->at(us_service_interface_iid<ITestServiceA>()))
+                  .get());
+
+    services.resize(10);
+    ASSERT_EQ(90u, sf->released.size());
+
+    // The remaining objects are released when the service is unregistered,
+    // and not again when they are reset afterwards.
+    reg.Unregister();
+    ASSERT_EQ(100u, sf->released.size());
+    services.clear();
+    ASSERT_EQ(100u, sf->released.size());
+}
+
+TEST_F(ServiceFactoryTest, TestPrototypeServiceInstancePool)
+{
+    auto sf = std::make_shared<RecordingPrototypeFactory>(2);
+    auto reg = context.RegisterService<ITestServiceA>(ToFactory(sf));
+    auto objects = context.GetServiceObjects(reg.GetReference());
+
+    auto s1 = objects.GetService();
+    auto s2 = objects.GetService();
+    auto s3 = objects.GetService();
+    ASSERT_EQ(3u, sf->created.size());
+
+    // Two released objects fit into the pool, the third one is ungot.
+    auto const pooled = s1.get();
+    s1.reset();
+    s2.reset();
+    s3.reset();
+    ASSERT_EQ(1u, sf->released.size());
+
+    // Pooled objects are handed out again instead of creating new ones.
+    auto r1 = objects.GetService();
+    auto r2 = objects.GetService();
+    ASSERT_EQ(3u, sf->created.size());
+    ASSERT_TRUE(r1.get() == pooled || r2.get() == pooled);
+    auto r3 = objects.GetService();
+    ASSERT_EQ(4u, sf->created.size());
+
+    // Pooled and used objects are released on unregistration.
+    r1.reset();
+    reg.Unregister();
+    ASSERT_EQ(sf->created.size(), sf->released.size());
+}
@@ -661,6 +661,43 @@ TEST_F(ServiceHooksTest, TestFindHookCallbackOrdering)
     context.RemoveServiceListener(&serviceListener, &TestServiceListener::ServiceChanged);
 }
 
+TEST_F(ServiceHooksTest, TestFindHookReRanking)
+{
+    auto serviceFindHook1 = std::make_shared<MockServiceFindHook>();
+    auto serviceFindHook2 = std::make_shared<MockServiceFindHook>();
+
+    ::testing::InSequence s;
+    EXPECT_CALL(*serviceFindHook2, Find(::testing::_, ::testing::_, ::testing::_, ::testing::_));
+    EXPECT_CALL(*serviceFindHook1, Find(::testing::_, ::testing::_, ::testing::_, ::testing::_));
+    EXPECT_CALL(*serviceFindHook1, Find(::testing::_, ::testing::_, ::testing::_, ::testing::_));
+    EXPECT_CALL(*serviceFindHook2, Find(::testing::_, ::testing::_, ::testing::_, ::testing::_));
+    EXPECT_CALL(*serviceFindHook2, Find(::testing::_, ::testing::_, ::testing::_, ::testing::_));
+
+    ServiceProperties hookProps1;
+    hookProps1[Constants::SERVICE_RANKING] = 0;
+    ServiceRegistration<ServiceFindHook> findHookReg1
+        = context.RegisterService<ServiceFindHook>(serviceFindHook1, hookProps1);
+
+    ServiceProperties hookProps2;
+    hookProps2[Constants::SERVICE_RANKING] = 10;
+    ServiceRegistration<ServiceFindHook> findHookReg2
+        = context.RegisterService<ServiceFindHook>(serviceFindHook2, hookProps2);
+
+    ASSERT_EQ(context.GetServiceReferences<ServiceFindHook>().size(), 2);
+
+    // the cached hook list must follow a ranking change
+    hookProps1[Constants::SERVICE_RANKING] = 20;
+    findHookReg1.SetProperties(hookProps1);
+    ASSERT_EQ(context.GetServiceReferences<ServiceFindHook>().size(), 2);
+
+    // and an unregistration
+    findHookReg1.Unregister();
+    ASSERT_EQ(context.GetServiceReferences<ServiceFindHook>().size(), 1);
+
+    findHookReg2.Unregister();
+    ASSERT_TRUE(context.GetServiceReferences<ServiceFindHook>().empty());
+}
+
 TEST_F(ServiceHooksTest, TestEventListenerHookCallbackOrdering)
 {
     TestServiceListener serviceListener1;
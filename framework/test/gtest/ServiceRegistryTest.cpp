@@ -24,11 +24,15 @@
 #include "cppmicroservices/Framework.h"
 #include "cppmicroservices/FrameworkEvent.h"
 #include "cppmicroservices/FrameworkFactory.h"
+#include "cppmicroservices/ServiceEvent.h"
 
 #include "TestUtils.h"
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 using namespace cppmicroservices;
 
@@ -205,3 +209,138 @@ TEST_F(ServiceRegistryTest, TestServicePropertiesUpdate)
     reg2.Unregister();
     ASSERT_TRUE(context.GetServiceReferences<ITestServiceA>().empty());
 }
+
+TEST_F(ServiceRegistryTest, TestServicePropertiesDeltaUpdate)
+{
+    ServiceProperties props;
+    props["counter"] = 1;
+    props["Name"] = std::string("first");
+    props["removed"] = true;
+    auto reg1 = context.RegisterService<ITestServiceA>(std::make_shared<TestServiceA>(), props);
+    auto reg2 = context.RegisterService<ITestServiceA>(std::make_shared<TestServiceA>(),
+                                                       { { Constants::SERVICE_RANKING, Any(50) } });
+    auto ref1 = reg1.GetReference();
+    auto const serviceId = ref1.GetProperty(Constants::SERVICE_ID);
+
+    reg1.UpdateProperties({ { "counter", Any(2) }, { "NAME", Any(std::string("second")) } }, { "Removed" });
+    ASSERT_EQ(2, any_cast<int>(ref1.GetProperty("counter")));
+    ASSERT_EQ("second", ref1.GetProperty("name").ToStringNoExcept());
+    ASSERT_TRUE(ref1.GetProperty("removed").Empty());
+    auto const keys = ref1.GetPropertyKeys();
+    ASSERT_EQ(1, std::count(keys.begin(), keys.end(), std::string("NAME")));
+    ASSERT_EQ(0, std::count(keys.begin(), keys.end(), std::string("Name")));
+
+    // Properties owned by the framework are not modified.
+    reg1.UpdateProperties({ { Constants::SERVICE_ID, Any(-1L) } }, { Constants::OBJECTCLASS });
+    ASSERT_EQ(any_cast<long>(serviceId), any_cast<long>(ref1.GetProperty(Constants::SERVICE_ID)));
+    ASSERT_FALSE(ref1.GetProperty(Constants::OBJECTCLASS).Empty());
+
+    ASSERT_THROW(reg1.UpdateProperties({ { Constants::SERVICE_RANKING, Any(std::string("high")) } }),
+                 std::invalid_argument);
+    ASSERT_THROW(reg1.UpdateProperties({ { "key", Any(1) }, { "KEY", Any(2) } }), std::invalid_argument);
+
+    // Raising the ranking reorders the services.
+    ASSERT_EQ(reg2.GetReference(), context.GetServiceReference<ITestServiceA>());
+    reg1.UpdateProperties({ { Constants::SERVICE_RANKING, Any(100) } });
+    ASSERT_EQ(ref1, context.GetServiceReference<ITestServiceA>());
+    reg1.UpdateProperties({}, { Constants::SERVICE_RANKING });
+    ASSERT_EQ(reg2.GetReference(), context.GetServiceReference<ITestServiceA>());
+
+    reg1.Unregister();
+    ASSERT_THROW(reg1.UpdateProperties({ { "counter", Any(3) } }), std::logic_error);
+    reg2.Unregister();
+}
+
+TEST_F(ServiceRegistryTest, TestServicePropertiesDeltaUpdateEvents)
+{
+    auto reg = context.RegisterService<ITestServiceA>(std::make_shared<TestServiceA>(),
+                                                      { { "counter", Any(1) }, { "mode", Any(std::string("on")) } });
+
+    std::vector<ServiceEvent::Type> counterEvents;
+    std::vector<ServiceEvent::Type> modeEvents;
+    auto counterToken = context.AddServiceListener([&counterEvents](ServiceEvent const& evt)
+                                                   { counterEvents.push_back(evt.GetType()); },
+                                                   "(counter<=1)");
+    auto modeToken = context.AddServiceListener([&modeEvents](ServiceEvent const& evt)
+                                                { modeEvents.push_back(evt.GetType()); },
+                                                "(mode=on)");
+
+    reg.UpdateProperties({ { "counter", Any(2) } });
+    ASSERT_EQ(std::vector<ServiceEvent::Type>({ ServiceEvent::SERVICE_MODIFIED_ENDMATCH }), counterEvents);
+    ASSERT_EQ(std::vector<ServiceEvent::Type>({ ServiceEvent::SERVICE_MODIFIED }), modeEvents);
+
+    reg.UpdateProperties({ { "counter", Any(0) } }, { "mode" });
+    ASSERT_EQ(std::vector<ServiceEvent::Type>({ ServiceEvent::SERVICE_MODIFIED_ENDMATCH,
+                                                ServiceEvent::SERVICE_MODIFIED }),
+              counterEvents);
+    ASSERT_EQ(std::vector<ServiceEvent::Type>({ ServiceEvent::SERVICE_MODIFIED,
+                                                ServiceEvent::SERVICE_MODIFIED_ENDMATCH }),
+              modeEvents);
+
+    // An update which changes nothing the framework allows does not fire events.
+    reg.UpdateProperties({ { Constants::SERVICE_SCOPE, Any(Constants::SCOPE_PROTOTYPE) } });
+    ASSERT_EQ(2u, counterEvents.size());
+    ASSERT_EQ(2u, modeEvents.size());
+
+    context.RemoveListener(std::move(counterToken));
+    context.RemoveListener(std::move(modeToken));
+    reg.Unregister();
+}
+
+TEST_F(ServiceRegistryTest, TestLookupByInterfaceIdAfterUnregister)
+{
+    auto s1 = std::make_shared<TestServiceA>();
+    auto regA = context.RegisterService<ITestServiceA>(s1);
+    auto regB = context.RegisterService<ITestServiceB>(std::make_shared<ITestServiceB>());
+
+    ASSERT_EQ(context.GetServiceReferences(us_service_interface_iid<ITestServiceB>()).size(), 1);
+    ASSERT_EQ(context.GetServiceReferences("com.mycompany.ITestService/1.0").size(), 1);
+    ASSERT_TRUE(context.GetServiceReferences("com.mycompany.ITestService/2.0").empty());
+
+    regB.Unregister();
+    ASSERT_TRUE(context.GetServiceReferences<ITestServiceB>().empty());
+    ASSERT_EQ(context.GetServiceReference<ITestServiceA>(), regA.GetReference());
+
+    regB = context.RegisterService<ITestServiceB>(std::make_shared<ITestServiceB>());
+    ASSERT_EQ(context.GetServiceReferences<ITestServiceB>().size(), 1);
+
+    regA.Unregister();
+    regB.Unregister();
+    ASSERT_TRUE(context.GetServiceReferences<ITestServiceA>().empty());
+    ASSERT_TRUE(context.GetServiceReferences<ITestServiceB>().empty());
+}
+
+TEST_F(ServiceRegistryTest, TestSingletonServiceUsesAcrossThreads)
+{
+    auto regA = context.RegisterService<ITestServiceA>(std::make_shared<TestServiceA>());
+    auto ref = regA.GetReference();
+    ASSERT_TRUE(ref.GetUsingBundles().empty());
+
+    // Get the service on several threads and release it on another one.
+    std::vector<std::shared_ptr<ITestServiceA>> services(8);
+    std::vector<std::thread> threads;
+    for (auto& service : services)
+    {
+        threads.emplace_back([this, &ref, &service]() { service = context.GetService(ref); });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    auto const usingBundles = ref.GetUsingBundles();
+    ASSERT_EQ(1u, usingBundles.size());
+    ASSERT_EQ(framework, usingBundles.front());
+
+    services.resize(1);
+    ASSERT_EQ(1u, ref.GetUsingBundles().size());
+    std::thread([&services]() { services.clear(); }).join();
+    ASSERT_TRUE(ref.GetUsingBundles().empty());
+
+    // Uses are dropped when the service is unregistered while in use.
+    auto service = context.GetService(ref);
+    ASSERT_EQ(1u, ref.GetUsingBundles().size());
+    regA.Unregister();
+    service.reset();
+    ASSERT_FALSE(ref);
+}
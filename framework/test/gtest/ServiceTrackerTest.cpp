@@ -39,6 +39,7 @@
 #include <memory>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -652,6 +653,235 @@ TEST_F(ServiceTrackerTestFixture, TestReOpenServiceTrackerWithCustomizer)
     tracker->Close();
 }
 
+namespace
+{
+
+    class MyBatchCustomizer final : public MyCustomizer
+    {
+
+      public:
+        MyBatchCustomizer(BundleContext const& context) : MyCustomizer(context) {}
+
+        bool
+        AddsInitialServicesInBatch() const override
+        {
+            return true;
+        }
+
+        std::shared_ptr<MyInterfaceOne>
+        AddingService(ServiceReference<MyInterfaceOne> const& reference) override
+        {
+            ++addingServiceCalls;
+            return MyCustomizer::AddingService(reference);
+        }
+
+        std::vector<std::shared_ptr<MyInterfaceOne>>
+        AddingServices(std::vector<ServiceReference<MyInterfaceOne>> const& references) override
+        {
+            batches.push_back(references);
+            std::vector<std::shared_ptr<MyInterfaceOne>> services;
+            for (std::size_t i = 0; i < references.size(); ++i)
+            {
+                // do not track every second service
+                services.push_back(i % 2 == 0 ? MyCustomizer::AddingService(references[i]) : nullptr);
+            }
+            return services;
+        }
+
+        int addingServiceCalls = 0;
+        std::vector<std::vector<ServiceReference<MyInterfaceOne>>> batches;
+    };
+
+    // Opts in to the batch, using the default AddingServices, and fails on the third service
+    class MyFailingBatchCustomizer final : public MyCustomizer
+    {
+
+      public:
+        MyFailingBatchCustomizer(BundleContext const& context) : MyCustomizer(context) {}
+
+        bool
+        AddsInitialServicesInBatch() const override
+        {
+            return true;
+        }
+
+        std::shared_ptr<MyInterfaceOne>
+        AddingService(ServiceReference<MyInterfaceOne> const& reference) override
+        {
+            if (++addingServiceCalls == 3)
+            {
+                throw std::runtime_error("AddingService failed");
+            }
+            return MyCustomizer::AddingService(reference);
+        }
+
+        void
+        RemovedService(ServiceReference<MyInterfaceOne> const& reference,
+                       std::shared_ptr<MyInterfaceOne> const& service) override
+        {
+            removed.push_back(reference);
+            MyCustomizer::RemovedService(reference, service);
+        }
+
+        int addingServiceCalls = 0;
+        std::vector<ServiceReference<MyInterfaceOne>> removed;
+    };
+
+    // Returns one more service object than references
+    class MyOversizedBatchCustomizer final : public MyCustomizer
+    {
+
+      public:
+        MyOversizedBatchCustomizer(BundleContext const& context) : MyCustomizer(context) {}
+
+        bool
+        AddsInitialServicesInBatch() const override
+        {
+            return true;
+        }
+
+        std::vector<std::shared_ptr<MyInterfaceOne>>
+        AddingServices(std::vector<ServiceReference<MyInterfaceOne>> const& references) override
+        {
+            std::vector<std::shared_ptr<MyInterfaceOne>> services;
+            for (auto const& reference : references)
+            {
+                services.push_back(MyCustomizer::AddingService(reference));
+            }
+            services.push_back(std::make_shared<MyInterfaceOne>());
+            return services;
+        }
+
+        void
+        RemovedService(ServiceReference<MyInterfaceOne> const& reference,
+                       std::shared_ptr<MyInterfaceOne> const& service) override
+        {
+            removed.push_back(reference);
+            MyCustomizer::RemovedService(reference, service);
+        }
+
+        std::vector<ServiceReference<MyInterfaceOne>> removed;
+    };
+} // namespace
+
+TEST_F(ServiceTrackerTestFixture, TestInitialServicesAddedInOneBatch)
+{
+    auto context = framework.GetBundleContext();
+    struct MyServiceOne : public MyInterfaceOne
+    {
+    };
+
+    // Given services registered before the tracker is opened
+    std::vector<ServiceRegistration<MyInterfaceOne>> registrations;
+    for (int ranking : { 0, 5, -3, 5, 10 })
+    {
+        registrations.push_back(context.RegisterService<MyInterfaceOne>(
+            std::make_shared<MyServiceOne>(),
+            { { Constants::SERVICE_RANKING, Any(ranking) } }));
+    }
+
+    MyBatchCustomizer customizer(context);
+    ServiceTracker<MyInterfaceOne> tracker(context, &customizer);
+    tracker.Open();
+
+    // Then they are added with a single call, highest ranking and lowest id first
+    ASSERT_EQ(1, customizer.batches.size());
+    EXPECT_EQ(0, customizer.addingServiceCalls);
+    auto const& references = customizer.batches[0];
+    ASSERT_EQ(registrations.size(), references.size());
+    EXPECT_EQ(registrations[4].GetReference(), references[0]);
+    EXPECT_EQ(registrations[1].GetReference(), references[1]);
+    EXPECT_EQ(registrations[3].GetReference(), references[2]);
+    EXPECT_EQ(registrations[0].GetReference(), references[3]);
+    EXPECT_EQ(registrations[2].GetReference(), references[4]);
+
+    // And only the services returned by the customizer are tracked
+    EXPECT_EQ(3, tracker.Size());
+    EXPECT_EQ(registrations[4].GetReference(), tracker.GetServiceReference());
+    EXPECT_EQ(nullptr, tracker.GetService(registrations[1].GetReference()));
+
+    // And services registered later use the single callback
+    auto lateRegistration = context.RegisterService<MyInterfaceOne>(std::make_shared<MyServiceOne>());
+    EXPECT_EQ(1, customizer.batches.size());
+    EXPECT_EQ(1, customizer.addingServiceCalls);
+    EXPECT_EQ(4, tracker.Size());
+
+    tracker.Close();
+}
+
+TEST_F(ServiceTrackerTestFixture, TestInitialServicesBatchRemovesAddedServicesOnException)
+{
+    auto context = framework.GetBundleContext();
+    struct MyServiceOne : public MyInterfaceOne
+    {
+    };
+
+    std::vector<ServiceRegistration<MyInterfaceOne>> registrations;
+    for (int i = 0; i < 4; ++i)
+    {
+        registrations.push_back(context.RegisterService<MyInterfaceOne>(std::make_shared<MyServiceOne>()));
+    }
+
+    MyFailingBatchCustomizer customizer(context);
+    ServiceTracker<MyInterfaceOne> tracker(context, &customizer);
+    EXPECT_THROW(tracker.Open(), std::runtime_error);
+
+    // The two services added before the exception are removed again, and none are tracked
+    EXPECT_EQ(3, customizer.addingServiceCalls);
+    std::vector<ServiceReference<MyInterfaceOne>> const expected = { registrations[0].GetReference(),
+                                                                     registrations[1].GetReference() };
+    EXPECT_EQ(expected, customizer.removed);
+    EXPECT_EQ(0, tracker.Size());
+    tracker.Close();
+}
+
+TEST_F(ServiceTrackerTestFixture, TestInitialServicesBatchWithTooManyObjectsIsReleased)
+{
+    auto context = framework.GetBundleContext();
+    struct MyServiceOne : public MyInterfaceOne
+    {
+    };
+
+    std::vector<ServiceRegistration<MyInterfaceOne>> registrations;
+    for (int i = 0; i < 2; ++i)
+    {
+        registrations.push_back(context.RegisterService<MyInterfaceOne>(std::make_shared<MyServiceOne>()));
+    }
+
+    MyOversizedBatchCustomizer customizer(context);
+    ServiceTracker<MyInterfaceOne> tracker(context, &customizer);
+    EXPECT_THROW(tracker.Open(), std::logic_error);
+
+    // Every object returned for a reference is removed again, and none are tracked
+    std::vector<ServiceReference<MyInterfaceOne>> const expected = { registrations[0].GetReference(),
+                                                                     registrations[1].GetReference() };
+    EXPECT_EQ(expected, customizer.removed);
+    EXPECT_EQ(0, tracker.Size());
+    tracker.Close();
+}
+
+TEST_F(ServiceTrackerTestFixture, TestInitialServicesDefaultToSingleCallbacks)
+{
+    auto context = framework.GetBundleContext();
+    MockCustomizedServiceTracker<MyInterfaceOne> customizer;
+    struct MyServiceOne : public MyInterfaceOne
+    {
+    };
+    auto svcReg1 = context.RegisterService<MyInterfaceOne>(std::make_shared<MyServiceOne>());
+    auto svcReg2 = context.RegisterService<MyInterfaceOne>(std::make_shared<MyServiceOne>());
+
+    // A customizer not opting in to the batch gets one AddingService call per service
+    ON_CALL(customizer, AddingService(::testing::_))
+        .WillByDefault(::testing::Return(std::make_shared<MyInterfaceOne>()));
+    EXPECT_CALL(customizer, AddingService(::testing::_)).Times(::testing::Exactly(2));
+    EXPECT_CALL(customizer, RemovedService(::testing::_, ::testing::_)).Times(::testing::Exactly(2));
+
+    ServiceTracker<MyInterfaceOne> tracker(context, &customizer);
+    tracker.Open();
+    EXPECT_EQ(2, tracker.Size());
+    tracker.Close();
+}
+
 namespace
 {
     namespace foo
@@ -41,6 +41,7 @@ struct EntryInfo
     mz_uint64 compressedSize;
     mz_uint64 uncompressedSize;
     mz_uint32 crc32;
+    mz_uint16 method; // 0 if stored, MZ_DEFLATED if compressed
 };
 
 /*
@@ -80,6 +81,7 @@ class ZipFile
             entry.compressedSize = filestat.m_comp_size;
             entry.uncompressedSize = filestat.m_uncomp_size;
             entry.crc32 = filestat.m_crc32;
+            entry.method = filestat.m_method;
             entries.push_back(entry);
         }
 
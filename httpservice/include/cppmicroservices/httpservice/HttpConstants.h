@@ -40,6 +40,18 @@ namespace cppmicroservices
         static std::string HTTP_WHITEBOARD_SERVLET_NAME();    // "org.cppmicroservices.http.whiteboard.servlet.name"
         static std::string HTTP_WHITEBOARD_SERVLET_PATTERN(); // "org.cppmicroservices.http.whiteboard.servlet.pattern"
         static std::string HTTP_WHITEBOARD_TARGET();          // "org.cppmicroservices.http.whiteboard.target"
+
+        /*
+         * ServletContainer configuration, read from the framework properties
+         * when the container is started. Unset properties keep the defaults
+         * of the embedded web server.
+         */
+        static std::string HTTP_SERVICE_NUM_THREADS();          // "org.cppmicroservices.http.num_threads"
+        static std::string HTTP_SERVICE_LISTENING_PORTS();      // "org.cppmicroservices.http.listening_ports"
+        static std::string HTTP_SERVICE_KEEP_ALIVE();           // "org.cppmicroservices.http.keep_alive"
+        static std::string HTTP_SERVICE_REQUEST_TIMEOUT_MS();   // "org.cppmicroservices.http.request_timeout_ms"
+        static std::string HTTP_SERVICE_TCP_NODELAY();          // "org.cppmicroservices.http.tcp_nodelay"
+        static std::string HTTP_SERVICE_RESPONSE_BUFFER_SIZE(); // "org.cppmicroservices.http.response.buffer_size"
     };
 } // namespace cppmicroservices
 
@@ -82,4 +82,46 @@ namespace cppmicroservices
         static std::string s = "org.cppmicroservices.http.whiteboard.target";
         return s;
     }
+
+    std::string
+    HttpConstants::HTTP_SERVICE_NUM_THREADS()
+    {
+        static std::string s = "org.cppmicroservices.http.num_threads";
+        return s;
+    }
+
+    std::string
+    HttpConstants::HTTP_SERVICE_LISTENING_PORTS()
+    {
+        static std::string s = "org.cppmicroservices.http.listening_ports";
+        return s;
+    }
+
+    std::string
+    HttpConstants::HTTP_SERVICE_KEEP_ALIVE()
+    {
+        static std::string s = "org.cppmicroservices.http.keep_alive";
+        return s;
+    }
+
+    std::string
+    HttpConstants::HTTP_SERVICE_REQUEST_TIMEOUT_MS()
+    {
+        static std::string s = "org.cppmicroservices.http.request_timeout_ms";
+        return s;
+    }
+
+    std::string
+    HttpConstants::HTTP_SERVICE_TCP_NODELAY()
+    {
+        static std::string s = "org.cppmicroservices.http.tcp_nodelay";
+        return s;
+    }
+
+    std::string
+    HttpConstants::HTTP_SERVICE_RESPONSE_BUFFER_SIZE()
+    {
+        static std::string s = "org.cppmicroservices.http.response.buffer_size";
+        return s;
+    }
 } // namespace cppmicroservices
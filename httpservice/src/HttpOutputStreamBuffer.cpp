@@ -26,19 +26,30 @@
 
 #include "civetweb/civetweb.h"
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
+#include <string>
 
 namespace cppmicroservices
 {
 
+    namespace
+    {
+        // "\r\n" ending a directly sent chunk, up to 16 hex digits and "\r\n"
+        std::size_t const CHUNK_HEADER_RESERVE = 2 + 16 + 2;
+        // "\r\n" ending the chunk and the final "0\r\n\r\n"
+        std::size_t const CHUNK_TRAILER_RESERVE = 2 + 5;
+    } // namespace
+
     HttpOutputStreamBuffer::HttpOutputStreamBuffer(HttpServletResponsePrivate* response, std::size_t bufferSize)
-        : m_Buffer(bufferSize + 1)
+        : m_Buffer(CHUNK_HEADER_RESERVE + bufferSize + 1 + CHUNK_TRAILER_RESERVE)
         , m_Response(response)
         , m_ChunkedCoding(true)
+        , m_PendingChunkEnd(false)
     {
-        char* base = &m_Buffer.front();
-        setp(base, base + m_Buffer.size() - 1);
+        char* base = &m_Buffer.front() + CHUNK_HEADER_RESERVE;
+        setp(base, base + bufferSize);
     }
 
     HttpOutputStreamBuffer::~HttpOutputStreamBuffer()
@@ -46,19 +57,17 @@ namespace cppmicroservices
         if (m_Response->m_Connection == nullptr)
             return;
 
-        // if not committed yet and (i.e. the content completely fits
+        // if not committed yet (i.e. the content completely fits
         // into the buffer and nobody synced the stream yet), then
-        // set the Content-Length if it is not automatically set.
+        // the Content-Length is known and chunked coding is not needed,
+        // unless the servlet already set a Content-Length itself.
         // This is equal to an explicit "close" operation.
-        if (!m_Response->m_IsCommited && m_Response->m_Headers.find("Content-Length") != m_Response->m_Headers.end())
+        if (!m_Response->m_IsCommited
+            && m_Response->m_Headers.find("Content-Length") == m_Response->m_Headers.end())
         {
             m_Response->m_Headers["Content-Length"] = m_Response->LexicalCast(static_cast<long>(pptr() - pbase()));
         }
-        sync();
-        if (m_ChunkedCoding)
-        {
-            mg_write(m_Response->m_Connection, "0\r\n\r\n", 5);
-        }
+        sendBuffer(true);
     }
 
     bool
@@ -66,17 +75,32 @@ namespace cppmicroservices
     {
         if (!m_Response->m_IsCommited)
         {
-            m_ChunkedCoding = m_Response->m_Headers.find("Content-Length") == m_Response->m_Headers.end();
-            if (m_ChunkedCoding)
-            {
-                m_Response->m_Headers["Transfer-Encoding"] = "chunked";
-            }
-            // this writes the headers if not already written
-            return m_Response->Commit();
+            std::string header = takeHeader();
+            m_Response->m_IsCommited = mg_write(m_Response->m_Connection, &header[0], header.size()) > 0;
+            return m_Response->m_IsCommited;
         }
         return true;
     }
 
+    std::string
+    HttpOutputStreamBuffer::takeHeader()
+    {
+        if (m_Response->m_IsCommited)
+        {
+            return std::string();
+        }
+
+        m_ChunkedCoding = m_Response->m_Headers.find("Content-Length") == m_Response->m_Headers.end();
+        if (m_ChunkedCoding)
+        {
+            m_Response->m_Headers["Transfer-Encoding"] = "chunked";
+        }
+        // the caller sends the headers; mark the response as committed so
+        // that they are not written a second time
+        m_Response->m_IsCommited = true;
+        return m_Response->GetHeaderString();
+    }
+
     std::streambuf::int_type
     HttpOutputStreamBuffer::overflow(int_type ch)
     {
@@ -93,6 +117,19 @@ namespace cppmicroservices
         return traits_type::eof();
     }
 
+    std::streamsize
+    HttpOutputStreamBuffer::xsputn(char const* s, std::streamsize n)
+    {
+        // small writes are collected in the put area
+        if (n < epptr() - pbase())
+        {
+            return std::streambuf::xsputn(s, n);
+        }
+
+        // large writes are sent from the caller's memory without copying
+        return sendDirect(s, static_cast<std::size_t>(n)) ? n : 0;
+    }
+
     int
     HttpOutputStreamBuffer::sync()
     {
@@ -100,30 +137,96 @@ namespace cppmicroservices
     }
 
     bool
-    HttpOutputStreamBuffer::sendBuffer()
+    HttpOutputStreamBuffer::sendBuffer(bool last)
     {
         if (!m_Response->m_Connection)
             return false;
 
-        // commit the response by writing the headers
-        if (!CommitStream())
-            return false;
+        std::string header = takeHeader();
 
-        // write the buffer contents
-        std::ptrdiff_t n = pptr() - pbase();
+        char* begin = pbase();
+        char* end = pptr();
+        std::ptrdiff_t n = end - begin;
         pbump(static_cast<int>(-n));
-        int bytesSend = 0;
+
         if (m_ChunkedCoding)
         {
-            // send chunk size
-            std::string chunkSize = m_Response->LexicalCastHex(static_cast<long>(n)) + "\r\n";
-            bytesSend += mg_write(m_Response->m_Connection, &chunkSize[0], chunkSize.size());
+            // frame the complete chunk in the space reserved around the put
+            // area, so that it goes out with a single write
+            if (n > 0)
+            {
+                std::string chunkSize = m_Response->LexicalCastHex(static_cast<long>(n)) + "\r\n";
+                if (m_PendingChunkEnd)
+                {
+                    chunkSize = "\r\n" + chunkSize;
+                    m_PendingChunkEnd = false;
+                }
+                begin -= chunkSize.size();
+                std::copy(chunkSize.begin(), chunkSize.end(), begin);
+                *end++ = '\r';
+                *end++ = '\n';
+            }
+            if (last)
+            {
+                if (m_PendingChunkEnd)
+                {
+                    *end++ = '\r';
+                    *end++ = '\n';
+                    m_PendingChunkEnd = false;
+                }
+                std::copy_n("0\r\n\r\n", 5, end);
+                end += 5;
+            }
         }
-        bytesSend += mg_write(m_Response->m_Connection, pbase(), n);
-        if (m_ChunkedCoding)
+
+        if (begin == end && header.empty())
+        {
+            return true;
+        }
+
+        int bytesSend = 0;
+        if (header.empty())
         {
-            bytesSend += mg_write(m_Response->m_Connection, "\r\n", 2);
+            bytesSend = mg_write(m_Response->m_Connection, begin, static_cast<std::size_t>(end - begin));
+        }
+        else
+        {
+            // send the headers and the data with a single write
+            header.append(begin, end);
+            bytesSend = mg_write(m_Response->m_Connection, &header[0], header.size());
+            m_Response->m_IsCommited = bytesSend > 0;
         }
         return bytesSend > 0;
     }
+
+    bool
+    HttpOutputStreamBuffer::sendDirect(char const* data, std::size_t size)
+    {
+        if (!m_Response->m_Connection)
+            return false;
+
+        std::string prefix = takeHeader();
+
+        // the buffered data and the new data are sent as one chunk, with
+        // one write for the framing and one for the payload. The CRLF
+        // ending the chunk is sent with the next write.
+        std::ptrdiff_t n = pptr() - pbase();
+        if (m_ChunkedCoding)
+        {
+            if (m_PendingChunkEnd)
+            {
+                prefix += "\r\n";
+            }
+            prefix += m_Response->LexicalCastHex(static_cast<long>(n + size)) + "\r\n";
+            m_PendingChunkEnd = true;
+        }
+        prefix.append(pbase(), n);
+        pbump(static_cast<int>(-n));
+
+        if (!prefix.empty() && mg_write(m_Response->m_Connection, &prefix[0], prefix.size()) <= 0)
+        {
+            return false;
+        }
+        return mg_write(m_Response->m_Connection, data, size) > 0;
+    }
 } // namespace cppmicroservices
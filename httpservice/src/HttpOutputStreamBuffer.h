@@ -27,6 +27,7 @@
 
 #include <memory>
 #include <streambuf>
+#include <string>
 #include <vector>
 
 namespace cppmicroservices
@@ -34,6 +35,15 @@ namespace cppmicroservices
 
     struct HttpServletResponsePrivate;
 
+    /**
+     * Stream buffer writing the response body to the connection.
+     *
+     * The put area is surrounded by reserved space so that the chunk size
+     * line, the chunk's trailing CRLF and the final empty chunk can be
+     * framed in place. On the first send, the response headers are sent
+     * together with the body data. Large writes bypass the put area and
+     * are sent directly from the caller's memory.
+     */
     class HttpOutputStreamBuffer : public std::streambuf
     {
       public:
@@ -46,9 +56,15 @@ namespace cppmicroservices
       private:
         int_type overflow(int_type ch);
 
+        std::streamsize xsputn(char const* s, std::streamsize n);
+
         int sync();
 
-        bool sendBuffer();
+        bool sendBuffer(bool last = false);
+
+        bool sendDirect(char const* data, std::size_t size);
+
+        std::string takeHeader();
 
         HttpOutputStreamBuffer(HttpOutputStreamBuffer const&);
         HttpOutputStreamBuffer& operator=(HttpOutputStreamBuffer const&);
@@ -57,6 +73,8 @@ namespace cppmicroservices
         std::vector<char> m_Buffer;
         HttpServletResponsePrivate* m_Response;
         bool m_ChunkedCoding;
+        // true if the CRLF terminating a directly sent chunk has not been sent yet
+        bool m_PendingChunkEnd;
     };
 } // namespace cppmicroservices
 
@@ -70,6 +70,15 @@ namespace cppmicroservices
         if (m_IsCommited)
             return true;
 
+        std::string header = GetHeaderString();
+        int n = mg_write(m_Connection, &header[0], header.size());
+        m_IsCommited = n > 0;
+        return m_IsCommited;
+    }
+
+    std::string
+    HttpServletResponsePrivate::GetHeaderString() const
+    {
         std::stringstream ss;
         ss << "HTTP/1.1 " << m_StatusCode << "\r\n";
         for (auto& m_Header : m_Headers)
@@ -77,11 +86,7 @@ namespace cppmicroservices
             ss << m_Header.first << ": " << m_Header.second << "\r\n";
         }
         ss << "\r\n";
-
-        std::string header = ss.str();
-        int n = mg_write(m_Connection, &header[0], header.size());
-        m_IsCommited = n > 0;
-        return m_IsCommited;
+        return ss.str();
     }
 
     std::string
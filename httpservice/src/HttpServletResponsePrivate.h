@@ -41,6 +41,9 @@ namespace cppmicroservices
 
         bool Commit();
 
+        // Returns the status line and headers, terminated by an empty line
+        std::string GetHeaderString() const;
+
         std::string LexicalCast(long int value);
         std::string LexicalCastHex(long int value);
 
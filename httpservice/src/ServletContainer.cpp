@@ -29,6 +29,7 @@
 #include "HttpServletRequestPrivate.h"
 #include "HttpServletResponsePrivate.h"
 #include "ServletConfigPrivate.h"
+#include "cppmicroservices/httpservice/HttpConstants.h"
 #include "cppmicroservices/httpservice/HttpServlet.h"
 #include "cppmicroservices/httpservice/HttpServletRequest.h"
 #include "cppmicroservices/httpservice/HttpServletResponse.h"
@@ -42,6 +43,7 @@
 #include <cassert>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace cppmicroservices
 {
@@ -51,9 +53,10 @@ namespace cppmicroservices
     class ServletHandler : public CivetHandler
     {
       public:
-        ServletHandler(std::shared_ptr<HttpServlet> servlet, std::string servletPath)
+        ServletHandler(std::shared_ptr<HttpServlet> servlet, std::string servletPath, std::size_t responseBufferSize)
             : m_Servlet(std::move(servlet))
             , m_ServletPath(std::move(servletPath))
+            , m_ResponseBufferSize(responseBufferSize)
         {
         }
 
@@ -94,7 +97,13 @@ namespace cppmicroservices
                 request.d->m_PathInfo = uri.substr(pathPrefix.size());
             }
 
-            HttpServletResponse response(new HttpServletResponsePrivate(&request, server, conn));
+            // HttpServletResponse does not own its private part. Deleting it
+            // after the servlet returns sends the buffered remainder of the
+            // body and, for chunked coding, the terminating chunk.
+            std::unique_ptr<HttpServletResponsePrivate> responsePrivate(
+                new HttpServletResponsePrivate(&request, server, conn));
+            HttpServletResponse response(responsePrivate.get());
+            response.SetBufferSize(m_ResponseBufferSize);
             response.SetStatus(HttpServletResponse::SC_OK);
 
             try
@@ -118,8 +127,48 @@ namespace cppmicroservices
       private:
         std::shared_ptr<HttpServlet> m_Servlet;
         std::string m_ServletPath;
+        std::size_t const m_ResponseBufferSize;
     };
 
+    namespace
+    {
+        // Upper bound for the configurable response buffer size.
+        constexpr unsigned long long MaxResponseBufferSize = 64ull * 1024 * 1024;
+
+        // How a civetweb option spells a boolean value. Boolean options
+        // take "yes"/"no", numeric flags like tcp_nodelay are only enabled
+        // by "1".
+        enum class BoolFormat
+        {
+            YesNo,
+            Numeric
+        };
+
+        struct ServerOption
+        {
+            std::string property;
+            char const* name;
+            BoolFormat boolFormat;
+        };
+
+        // Converts a framework property value into the string form
+        // expected by civetweb options.
+        std::string
+        ToOptionValue(Any const& value, BoolFormat boolFormat)
+        {
+            if (value.Type() == typeid(bool))
+            {
+                bool const on = any_cast<bool>(value);
+                if (boolFormat == BoolFormat::Numeric)
+                {
+                    return on ? "1" : "0";
+                }
+                return on ? "yes" : "no";
+            }
+            return value.ToString();
+        }
+    } // namespace
+
     //-------------------------------------------------------------------
     //-----------        ServletContainerPrivate       ------------------
     //-------------------------------------------------------------------
@@ -134,10 +183,58 @@ namespace cppmicroservices
         : m_Context(std::move(bundleCtx))
         , m_Server(nullptr)
         , m_ServletTracker(m_Context, this)
+        , m_ResponseBufferSize(1024)
         , q(q)
     {
     }
 
+    std::vector<std::string>
+    ServletContainerPrivate::GetServerOptions()
+    {
+        static ServerOption const optionMap[] = {
+            {         HttpConstants::HTTP_SERVICE_NUM_THREADS(),        "num_threads", BoolFormat::Numeric},
+            {     HttpConstants::HTTP_SERVICE_LISTENING_PORTS(),    "listening_ports", BoolFormat::Numeric},
+            {          HttpConstants::HTTP_SERVICE_KEEP_ALIVE(),  "enable_keep_alive",   BoolFormat::YesNo},
+            {HttpConstants::HTTP_SERVICE_REQUEST_TIMEOUT_MS(), "request_timeout_ms", BoolFormat::Numeric},
+            {         HttpConstants::HTTP_SERVICE_TCP_NODELAY(),        "tcp_nodelay", BoolFormat::Numeric}
+        };
+
+        std::vector<std::string> options;
+        for (auto const& option : optionMap)
+        {
+            Any value = m_Context.GetProperty(option.property);
+            if (!value.Empty())
+            {
+                options.emplace_back(option.name);
+                options.push_back(ToOptionValue(value, option.boolFormat));
+            }
+        }
+
+        Any bufferSize = m_Context.GetProperty(HttpConstants::HTTP_SERVICE_RESPONSE_BUFFER_SIZE());
+        if (!bufferSize.Empty())
+        {
+            unsigned long long size = 0;
+            try
+            {
+                size = std::stoull(bufferSize.ToString());
+            }
+            catch (std::exception const&)
+            {
+            }
+
+            if (size > 0 && size <= MaxResponseBufferSize)
+            {
+                m_ResponseBufferSize = static_cast<std::size_t>(size);
+            }
+            else
+            {
+                std::cout << "Ignoring invalid value for " << HttpConstants::HTTP_SERVICE_RESPONSE_BUFFER_SIZE()
+                          << ": " << bufferSize.ToString() << std::endl;
+            }
+        }
+        return options;
+    }
+
     void
     ServletContainerPrivate::Start()
     {
@@ -149,7 +246,15 @@ namespace cppmicroservices
             if (m_Server)
                 return;
 
-            m_Server = std::make_unique<CivetServer>(nullptr);
+            try
+            {
+                m_Server = std::make_unique<CivetServer>(GetServerOptions());
+            }
+            catch (CivetException const& e)
+            {
+                std::cout << "Servlet Container could not be started: " << e.what() << std::endl;
+                throw;
+            }
             mg_context const* serverContext = m_Server->getContext();
             if (serverContext == nullptr)
             {
@@ -215,12 +320,12 @@ namespace cppmicroservices
         }
         std::shared_ptr<ServletContext> servletContext(new ServletContext(q));
         servlet->Init(ServletConfigImpl(servletContext));
-        auto handler = std::make_shared<ServletHandler>(servlet, contextRoot.ToString());
-
         std::string ctxPath;
+        std::shared_ptr<ServletHandler> handler;
         {
             Lock l(m_Mutex);
             US_UNUSED(l);
+            handler = std::make_shared<ServletHandler>(servlet, contextRoot.ToString(), m_ResponseBufferSize);
             m_Handler.push_back(handler);
             m_ServletContextMap[contextRoot.ToString()] = servletContext;
             ctxPath = m_ContextPath + contextRoot.ToString();
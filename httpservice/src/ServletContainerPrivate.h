@@ -28,6 +28,9 @@
 
 #include "cppmicroservices/httpservice/HttpServlet.h"
 
+#include <string>
+#include <vector>
+
 class CivetServer;
 
 namespace cppmicroservices
@@ -48,6 +51,13 @@ namespace cppmicroservices
 
         std::string GetMimeType(ServletContext const* context, std::string const& file) const;
 
+        /**
+         * Collects the civetweb options from the framework properties and
+         * updates the default response buffer size. Must be called with
+         * m_Mutex held.
+         */
+        std::vector<std::string> GetServerOptions();
+
         BundleContext m_Context;
 
         std::mutex m_Mutex;
@@ -56,6 +66,7 @@ namespace cppmicroservices
 
         std::map<std::string, std::shared_ptr<ServletContext>> m_ServletContextMap;
         std::string m_ContextPath;
+        std::size_t m_ResponseBufferSize;
 
       private:
         ServletContainer* const q;
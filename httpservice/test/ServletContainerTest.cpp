@@ -0,0 +1,90 @@
+/*=============================================================================
+
+ Library: CppMicroServices
+
+ Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+ file at the top-level directory of this distribution and at
+ https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+ http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ =============================================================================*/
+
+#include "ServletContainerPrivate.h"
+#include "cppmicroservices/httpservice/HttpConstants.h"
+
+#include "cppmicroservices/Framework.h"
+#include "cppmicroservices/FrameworkEvent.h"
+#include "cppmicroservices/FrameworkFactory.h"
+
+#include "civetweb/CivetServer.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+using namespace cppmicroservices;
+
+namespace
+{
+    class ServletContainerTest : public ::testing::Test
+    {
+      protected:
+        void
+        StartFramework(FrameworkConfiguration config)
+        {
+            // let the system pick a free port
+            config.emplace(HttpConstants::HTTP_SERVICE_LISTENING_PORTS(), std::string("0"));
+            framework = FrameworkFactory().NewFramework(config);
+            framework.Start();
+        }
+
+        void
+        TearDown() override
+        {
+            framework.Stop();
+            framework.WaitForStop(std::chrono::milliseconds::zero());
+        }
+
+        Framework framework { FrameworkFactory().NewFramework() };
+    };
+
+    TEST_F(ServletContainerTest, TcpNoDelayEnablesNumericOption)
+    {
+        StartFramework({
+            {HttpConstants::HTTP_SERVICE_TCP_NODELAY(), true}
+        });
+
+        ServletContainerPrivate container(framework.GetBundleContext(), nullptr);
+        container.Start();
+        ASSERT_NE(nullptr, container.m_Server);
+
+        // civetweb only enables TCP_NODELAY for the exact value "1"
+        EXPECT_STREQ("1", mg_get_option(container.m_Server->getContext(), "tcp_nodelay"));
+        container.Stop();
+    }
+
+    TEST_F(ServletContainerTest, KeepAliveUsesYesNoOption)
+    {
+        StartFramework({
+            {HttpConstants::HTTP_SERVICE_KEEP_ALIVE(), true}
+        });
+
+        ServletContainerPrivate container(framework.GetBundleContext(), nullptr);
+        container.Start();
+        ASSERT_NE(nullptr, container.m_Server);
+
+        EXPECT_STREQ("yes", mg_get_option(container.m_Server->getContext(), "enable_keep_alive"));
+        container.Stop();
+    }
+} // namespace
@@ -27,6 +27,7 @@
 #include "cppmicroservices/BundleContext.h"
 #include "cppmicroservices/BundleResource.h"
 #include "cppmicroservices/BundleResourceStream.h"
+#include "cppmicroservices/LockProfiler.h"
 
 #include "scheme-private.h"
 #include "scheme.h"
@@ -322,6 +323,20 @@ extern "C"
 
         return sc->F;
     }
+
+    pointer
+    us_lock_stats(scheme* sc, pointer /*args*/)
+    {
+        LockProfiler::WriteReport(std::cout);
+        return sc->T;
+    }
+
+    pointer
+    us_lock_stats_reset(scheme* sc, pointer /*args*/)
+    {
+        LockProfiler::Reset();
+        return sc->T;
+    }
 }
 
 namespace cppmicroservices
@@ -424,6 +439,14 @@ namespace cppmicroservices
                       d->m_Scheme->global_env,
                       mk_symbol(d->m_Scheme, "us-install"),
                       mk_foreign_func(d->m_Scheme, us_install));
+        scheme_define(d->m_Scheme,
+                      d->m_Scheme->global_env,
+                      mk_symbol(d->m_Scheme, "us-lock-stats"),
+                      mk_foreign_func(d->m_Scheme, us_lock_stats));
+        scheme_define(d->m_Scheme,
+                      d->m_Scheme->global_env,
+                      mk_symbol(d->m_Scheme, "us-lock-stats-reset"),
+                      mk_foreign_func(d->m_Scheme, us_lock_stats_reset));
     }
 
     ShellService::~ShellService() { scheme_deinit(d->m_Scheme); }
@@ -4970,7 +4970,7 @@ mz_zip_reader_extract_iter_state* mz_zip_reader_extract_iter_new(mz_zip_archive
     pState->out_blk_remain = 0;
 
     /* Read and parse the local directory entry. */
-    pState->cur_file_ofs = pState->file_stat.m_local_header_ofs;
+    pState->cur_file_ofs = pZip->m_archive_file_ofs + pState->file_stat.m_local_header_ofs;
     if (pZip->m_pRead(pZip->m_pIO_opaque, pState->cur_file_ofs, pLocal_header, MZ_ZIP_LOCAL_DIR_HEADER_SIZE) != MZ_ZIP_LOCAL_DIR_HEADER_SIZE)
     {
         mz_zip_set_error(pZip, MZ_ZIP_FILE_READ_FAILED);
@@ -23,20 +23,32 @@
 #include "miniz.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <sys/stat.h>
+#include <sys/types.h>
+
 #include <nowide/args.hpp>
 #include <nowide/fstream.hpp>
 
@@ -97,6 +109,18 @@ us_tempfile()
     return std::string(szTempFileName);
 }
 
+static bool
+us_file_modified_time(std::string const& fileName, MZ_TIME_T& modifiedTime)
+{
+    struct _stat64 fileStat;
+    if (_stat64(fileName.c_str(), &fileStat) != 0)
+    {
+        return false;
+    }
+    modifiedTime = fileStat.st_mtime;
+    return true;
+}
+
 #else
 
 #    include <unistd.h>
@@ -119,6 +143,18 @@ us_tempfile()
     return std::string(temppath);
 }
 
+static bool
+us_file_modified_time(std::string const& fileName, MZ_TIME_T& modifiedTime)
+{
+    struct stat fileStat;
+    if (stat(fileName.c_str(), &fileStat) != 0)
+    {
+        return false;
+    }
+    modifiedTime = fileStat.st_mtime;
+    return true;
+}
+
 #endif
 
 // ---------------------------------------------------------------------------------
@@ -312,6 +348,386 @@ namespace
         std::clog << "final (validated) manifest.json:\n" << manifestJson.toStyledString() << std::endl;
         return manifestJson;
     }
+
+    /*
+     * @brief Compression levels of resource files, chosen by glob patterns.
+     *
+     * A rule has the form <pattern>=<level>, e.g. "*.png=0" or "*.json=9". The
+     * pattern is matched against the whole resource path, where '*' matches
+     * any sequence of characters, including '/', and '?' any single character.
+     * The first matching rule applies. Files which match no rule use the
+     * default level.
+     */
+    class CompressionPolicy
+    {
+      public:
+        explicit CompressionPolicy(int defaultLevel) : defaultLevel(defaultLevel) {}
+
+        /*
+         * @brief adds a rule, which takes precedence over rules added later.
+         * @throw std::invalid_argument if the rule is malformed.
+         */
+        void
+        AddRule(std::string const& rule)
+        {
+            auto const pos = rule.find_last_of('=');
+            if (pos == 0 || pos == std::string::npos || pos + 1 == rule.size())
+            {
+                throw std::invalid_argument("Invalid compression rule '" + rule + "', expected <pattern>=<level>");
+            }
+            char* endptr = nullptr;
+            errno = 0;
+            long level = strtol(rule.c_str() + pos + 1, &endptr, 10);
+            if (errno != 0 || *endptr != '\0' || level < 0 || level > MZ_UBER_COMPRESSION)
+            {
+                throw std::invalid_argument("Invalid compression level in rule '" + rule + "', expected 0 to "
+                                            + std::to_string(static_cast<int>(MZ_UBER_COMPRESSION)));
+            }
+            rules.emplace_back(rule.substr(0, pos), static_cast<int>(level));
+        }
+
+        int
+        GetDefaultLevel() const
+        {
+            return defaultLevel;
+        }
+
+        int
+        GetLevel(std::string const& resFileName) const
+        {
+            for (auto const& rule : rules)
+            {
+                if (Matches(rule.first, resFileName))
+                {
+                    return rule.second;
+                }
+            }
+            return defaultLevel;
+        }
+
+      private:
+        static bool
+        Matches(std::string const& pattern, std::string const& name)
+        {
+            std::size_t p = 0;
+            std::size_t n = 0;
+            // position after the last '*' seen in pattern, and where it started matching in name
+            std::size_t starP = std::string::npos;
+            std::size_t starN = 0;
+            while (n < name.size())
+            {
+                if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n]))
+                {
+                    ++p;
+                    ++n;
+                }
+                else if (p < pattern.size() && pattern[p] == '*')
+                {
+                    starP = ++p;
+                    starN = n;
+                }
+                else if (starP != std::string::npos)
+                {
+                    p = starP;
+                    n = ++starN;
+                }
+                else
+                {
+                    return false;
+                }
+            }
+            while (p < pattern.size() && pattern[p] == '*')
+            {
+                ++p;
+            }
+            return p == pattern.size();
+        }
+
+        int defaultLevel;
+        std::vector<std::pair<std::string, int>> rules;
+    };
+
+    /*
+     * @brief The content of a resource file, prepared for adding it to a zip archive.
+     */
+    struct CompressedResource
+    {
+        std::vector<unsigned char> data; // raw deflate stream if deflated, the file content otherwise
+        mz_uint64 uncompressedSize;
+        mz_uint32 crc32;
+        bool deflated;
+    };
+
+    using CompressedResourcePtr = std::unique_ptr<CompressedResource const>;
+
+    /*
+     * @brief 64-bit FNV-1a hash, used together with the size and CRC-32 of a
+     * resource file to recognize files with identical content.
+     */
+    std::uint64_t
+    fnv1aHash(std::vector<unsigned char> const& content)
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (auto c : content)
+        {
+            hash = (hash ^ c) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    /*
+     * @brief reads the content and modification time of a resource file.
+     * @throw std::runtime_error if the file could not be read.
+     */
+    std::vector<unsigned char>
+    readResourceFile(std::string const& resFileName, MZ_TIME_T& modifiedTime)
+    {
+        if (!us_file_modified_time(resFileName, modifiedTime))
+        {
+            throw std::runtime_error("Could not stat file " + resFileName);
+        }
+
+        nowide::ifstream file(resFileName, std::ios::in | std::ios::binary);
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Could not open file " + resFileName);
+        }
+        file.seekg(0, std::ios::end);
+        std::streamoff size = file.tellg();
+        file.seekg(0, std::ios::beg);
+        std::vector<unsigned char> content(static_cast<std::size_t>(size));
+        if (size < 0 || !file.read(reinterpret_cast<char*>(content.data()), size))
+        {
+            throw std::runtime_error("Could not read file " + resFileName);
+        }
+        return content;
+    }
+
+    /*
+     * @brief deflates a resource file's content the same way mz_zip_writer_add_file
+     * does. Level 0, files of up to 3 bytes and content which does not get smaller
+     * when deflated, e.g. images or archives, are stored uncompressed.
+     * @throw std::runtime_error if compressing the content failed.
+     */
+    CompressedResourcePtr
+    compressResource(std::string const& resFileName, std::vector<unsigned char> content, mz_uint32 crc32, int level)
+    {
+        auto resource = std::make_unique<CompressedResource>();
+        resource->uncompressedSize = content.size();
+        resource->crc32 = crc32;
+        resource->deflated = level != 0 && content.size() > 3;
+        if (!resource->deflated)
+        {
+            resource->data = std::move(content);
+            return resource;
+        }
+
+        size_t length = 0;
+        void* data = tdefl_compress_mem_to_heap(
+            content.data(),
+            content.size(),
+            &length,
+            static_cast<int>(tdefl_create_comp_flags_from_zip_params(level, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY)));
+        std::unique_ptr<void, void (*)(void*)> deflatedContent(data, ::free);
+        if (!deflatedContent)
+        {
+            throw std::runtime_error("Failed to compress file " + resFileName);
+        }
+        if (length >= content.size())
+        {
+            resource->deflated = false;
+            resource->data = std::move(content);
+            return resource;
+        }
+        auto begin = static_cast<unsigned char const*>(deflatedContent.get());
+        resource->data.assign(begin, begin + length);
+        return resource;
+    }
+
+    /*
+     * @brief Reads and compresses resource files on a pool of worker threads.
+     *
+     * Files are claimed by the workers in the order given, so that they are
+     * compressed roughly in the order the archive is written. Workers stay at
+     * most a few files per thread ahead of the writer. A file with the same
+     * content as an earlier file is not compressed again; the writer copies the
+     * earlier file's entry instead. If no worker thread can be started, each
+     * file is compressed when it is requested.
+     */
+    class ResourceFileCompressor
+    {
+      public:
+        static constexpr std::size_t NO_SHARED_CONTENT = static_cast<std::size_t>(-1);
+
+        // compressed files waiting to be written, per worker thread
+        static constexpr std::size_t FILES_PER_WORKER = 4;
+
+        ResourceFileCompressor(std::vector<std::string> const& resFileNames,
+                               std::vector<int> const& levels,
+                               unsigned int jobs)
+            : entries(resFileNames.size())
+            , nextEntry(0)
+            , maxEntry(0)
+            , window(0)
+        {
+            assert(levels.size() == resFileNames.size());
+            for (std::size_t i = 0; i < resFileNames.size(); ++i)
+            {
+                entries[i].fileName = resFileNames[i];
+                entries[i].level = levels[i];
+                entries[i].modifiedTime = 0;
+                entries[i].result = entries[i].promise.get_future();
+            }
+
+            jobs = static_cast<unsigned int>(std::min<std::size_t>(jobs, entries.size()));
+            window = FILES_PER_WORKER * jobs;
+            maxEntry = window;
+            for (unsigned int i = 0; jobs > 1 && i < jobs; ++i)
+            {
+                try
+                {
+                    workers.emplace_back([this] { Run(); });
+                }
+                catch (std::system_error const& e)
+                {
+                    std::clog << "Could not start compression thread: " << e.what() << std::endl;
+                    break;
+                }
+            }
+        }
+
+        ~ResourceFileCompressor()
+        {
+            // stop claiming files, e.g. if writing the archive failed
+            {
+                std::lock_guard<std::mutex> lock(progressMutex);
+                nextEntry = entries.size();
+                maxEntry = entries.size();
+            }
+            progress.notify_all();
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        ResourceFileCompressor(ResourceFileCompressor const&) = delete;
+        ResourceFileCompressor& operator=(ResourceFileCompressor const&) = delete;
+
+        /*
+         * @brief Waits for the resource file at \c index to be compressed.
+         * Must be called with increasing indices.
+         * @param modifiedTime set to the modification time of the file.
+         * @param sharedWith set to the index of an earlier file with identical
+         * content, in which case no compressed content is returned, or to
+         * NO_SHARED_CONTENT.
+         * @throw std::runtime_error if the file could not be read or compressed.
+         */
+        CompressedResourcePtr
+        Get(std::size_t index, MZ_TIME_T& modifiedTime, std::size_t& sharedWith)
+        {
+            if (workers.empty())
+            {
+                Compress(entries[index]);
+            }
+            Entry& entry = entries[index];
+            auto resource = entry.result.get();
+            if (!workers.empty())
+            {
+                {
+                    std::lock_guard<std::mutex> lock(progressMutex);
+                    maxEntry = index + 1 + window;
+                }
+                progress.notify_all();
+            }
+            modifiedTime = entry.modifiedTime;
+            sharedWith = entry.sharedWith;
+            return resource;
+        }
+
+      private:
+        struct Entry
+        {
+            std::string fileName;
+            int level;
+            MZ_TIME_T modifiedTime;
+            std::size_t sharedWith = NO_SHARED_CONTENT;
+            std::promise<CompressedResourcePtr> promise;
+            std::future<CompressedResourcePtr> result;
+        };
+
+        // size, CRC-32 and FNV-1a hash of the content, and the compression level
+        using ContentKey = std::tuple<mz_uint64, mz_uint32, std::uint64_t, int>;
+
+        void
+        Run()
+        {
+            for (;;)
+            {
+                std::size_t index = 0;
+                {
+                    std::unique_lock<std::mutex> lock(progressMutex);
+                    progress.wait(lock, [this] { return nextEntry < maxEntry || nextEntry >= entries.size(); });
+                    if (nextEntry >= entries.size())
+                    {
+                        return;
+                    }
+                    index = nextEntry++;
+                }
+                Compress(entries[index]);
+            }
+        }
+
+        void
+        Compress(Entry& entry)
+        {
+            try
+            {
+                auto content = readResourceFile(entry.fileName, entry.modifiedTime);
+                auto crc32 = static_cast<mz_uint32>(mz_crc32(MZ_CRC32_INIT, content.data(), content.size()));
+                ContentKey key(content.size(), crc32, fnv1aHash(content), entry.level);
+
+                // only an earlier file can be copied, as the archive is written in order
+                std::size_t const index = static_cast<std::size_t>(&entry - entries.data());
+                if (!content.empty())
+                {
+                    std::lock_guard<std::mutex> lock(contentsMutex);
+                    auto iter = contents.emplace(key, index).first;
+                    if (iter->second < index)
+                    {
+                        entry.sharedWith = iter->second;
+                    }
+                    else
+                    {
+                        iter->second = index;
+                    }
+                }
+
+                if (entry.sharedWith == NO_SHARED_CONTENT)
+                {
+                    entry.promise.set_value(compressResource(entry.fileName, std::move(content), crc32, entry.level));
+                }
+                else
+                {
+                    entry.promise.set_value(nullptr);
+                }
+            }
+            catch (...)
+            {
+                entry.promise.set_exception(std::current_exception());
+            }
+        }
+
+        std::vector<Entry> entries;
+        std::mutex progressMutex;
+        std::condition_variable progress;
+        std::size_t nextEntry; // next file to claim
+        std::size_t maxEntry;  // files from here on wait until the writer catches up
+        std::size_t window;
+        std::mutex contentsMutex;
+        std::map<ContentKey, std::size_t> contents; // first file with the content
+        std::vector<std::thread> workers;
+    };
 } // namespace
 
 /*
@@ -320,7 +736,9 @@ namespace
 class ZipArchive
 {
   public:
-    ZipArchive(std::string const& archiveFileName, int compressionLevel, std::string const& bundleName);
+    ZipArchive(std::string const& archiveFileName,
+               CompressionPolicy const& compressionPolicy,
+               std::string const& bundleName);
     virtual ~ZipArchive();
     /*
      * @brief Add manifest.json to this zip archive
@@ -331,13 +749,14 @@ class ZipArchive
     void AddManifestFile(Json::Value const& manifest);
 
     /*
-     * @brief Add a file to this zip archive
-     * @throw std::runtime exception if failed to add the resource file
+     * @brief Add files to this zip archive. The files are compressed in parallel
+     *        and written to the archive in the given order.
+     * @throw std::runtime exception if failed to add any of the resource files
      * @throw InvalidManifest if manifest.json is invalid
-     * @param resFileName is the path to the resource to be added
-     * @param isManifest indicates if the file is the bundle's manifest
+     * @param resFileNames are the paths to the resources to be added
+     * @param jobs is the number of threads used to compress the resources
      */
-    void AddResourceFile(std::string const& resFileName, bool isManifest = false);
+    void AddResourceFiles(std::set<std::string> const& resFileNames, unsigned int jobs);
 
     /*
      * @brief Add all files from another zip archive to this zip archive
@@ -354,12 +773,30 @@ class ZipArchive
     ZipArchive& operator=(ZipArchive&&) = delete;
 
   private:
+    /*
+     * @brief Get the archive entry name of a resource file
+     * @throw std::runtime exception if the archive entry already exists
+     * @throw InvalidManifest if manifest.json is invalid
+     * @param resFileName is the path to the resource to be added
+     * @param isManifest indicates if the file is the bundle's manifest
+     */
+    std::string GetResourceArchiveEntry(std::string const& resFileName, bool isManifest = false);
+
     /*
      * @brief Add a directory entry to the zip archive
      * @throw std::runtime exception if failed to add the entry
      */
     void AddDirectory(std::string const& dirName);
 
+    /*
+     * @brief Add a file entry with the content of an entry written earlier,
+     *        copied without decompressing it
+     * @throw std::runtime exception if failed to read or add the entry
+     * @param fileIndex is the index of the earlier entry in this zip archive
+     * @param level is the compression level the earlier entry was written with
+     */
+    void AddCopy(std::string const& archiveEntry, mz_uint fileIndex, int level, MZ_TIME_T& modifiedTime);
+
     /*
      * @brief Checks whether the archive file entry already
      *        exists in the zip archive. If it does, throw an exception.
@@ -375,16 +812,18 @@ class ZipArchive
     }
 
     std::string fileName;
-    int compressionLevel;
+    CompressionPolicy compressionPolicy;
     std::string bundleName;
     std::unique_ptr<mz_zip_archive> writeArchive;
     std::set<std::string> archivedNames; // list of all the file entries
     std::set<std::string> archivedDirs;  // list of all directory entries
 };
 
-ZipArchive::ZipArchive(std::string const& archiveFileName, int compressionLevel, std::string const& bName)
+ZipArchive::ZipArchive(std::string const& archiveFileName,
+                       CompressionPolicy const& compressionPolicy,
+                       std::string const& bName)
     : fileName(archiveFileName)
-    , compressionLevel(compressionLevel)
+    , compressionPolicy(compressionPolicy)
     , bundleName(bName)
     , writeArchive(new mz_zip_archive())
 {
@@ -392,7 +831,8 @@ ZipArchive::ZipArchive(std::string const& archiveFileName, int compressionLevel,
     // clear the contents of a outFile if it exists
     nowide::ofstream ofile(fileName, nowide::ofstream::trunc);
     ofile.close();
-    if (!mz_zip_writer_init_file(writeArchive.get(), fileName.c_str(), 0))
+    // resource files with identical content are copied from the archive written so far
+    if (!mz_zip_writer_init_file_v2(writeArchive.get(), fileName.c_str(), 0, MZ_ZIP_FLAG_WRITE_ALLOW_READING))
     {
         throw std::runtime_error("Internal error, could not init new zip archive");
     }
@@ -422,15 +862,15 @@ ZipArchive::AddManifestFile(Json::Value const& manifest)
                                  archiveEntry.c_str(),
                                  styledManifestJson.c_str(),
                                  styledManifestJson.size(),
-                                 compressionLevel))
+                                 compressionPolicy.GetLevel("manifest.json")))
     {
         throw std::runtime_error("Error writing manifest.json to archive " + fileName);
     }
     AddDirectory(bundleName + "/");
 }
 
-void
-ZipArchive::AddResourceFile(std::string const& resFileName, bool isManifest)
+std::string
+ZipArchive::GetResourceArchiveEntry(std::string const& resFileName, bool isManifest)
 {
     std::string archiveName = resFileName;
 
@@ -451,22 +891,129 @@ ZipArchive::AddResourceFile(std::string const& resFileName, bool isManifest)
 
     std::string archiveEntry = bundleName + "/" + archiveName;
     CheckAndAddToArchivedNames(archiveEntry);
+    return archiveEntry;
+}
 
-    if (!mz_zip_writer_add_file(writeArchive.get(),
-                                archiveEntry.c_str(),
-                                resFileName.c_str(),
-                                NULL,
-                                0,
-                                compressionLevel))
+void
+ZipArchive::AddResourceFiles(std::set<std::string> const& resFileNames, unsigned int jobs)
+{
+    // mz_zip_writer_add_file treats negative levels as the default level
+    int const defaultLevel = compressionPolicy.GetDefaultLevel();
+    if (defaultLevel > MZ_UBER_COMPRESSION)
     {
-        throw std::runtime_error("Error writing file to archive");
+        throw std::runtime_error("Invalid compression level " + std::to_string(defaultLevel));
     }
-    // add a directory entries for the file path
-    size_t lastPathSeparatorPos = archiveEntry.find("/", 0);
-    while (lastPathSeparatorPos != std::string::npos)
+
+    std::vector<std::string> fileNames(resFileNames.begin(), resFileNames.end());
+    std::vector<std::string> archiveEntries;
+    std::vector<int> levels;
+    for (auto const& resFileName : fileNames)
     {
-        AddDirectory(archiveEntry.substr(0, lastPathSeparatorPos + 1));
-        lastPathSeparatorPos = archiveEntry.find("/", lastPathSeparatorPos + 1);
+        archiveEntries.push_back(GetResourceArchiveEntry(resFileName));
+        // rules match the path of the resource within the bundle
+        int level = compressionPolicy.GetLevel(archiveEntries.back().substr(bundleName.size() + 1));
+        levels.push_back(level < 0 ? MZ_DEFAULT_LEVEL : level);
+    }
+
+    // Compression runs ahead on the worker threads while the compressed files
+    // are written here, in order, to keep the archive deterministic.
+    ResourceFileCompressor compressor(fileNames, levels, jobs);
+    std::vector<mz_uint> fileIndices; // index of each written resource file in the archive
+    for (std::size_t i = 0; i < archiveEntries.size(); ++i)
+    {
+        std::string const& archiveEntry = archiveEntries[i];
+        MZ_TIME_T modifiedTime;
+        std::size_t sharedWith = ResourceFileCompressor::NO_SHARED_CONTENT;
+        auto resource = compressor.Get(i, modifiedTime, sharedWith);
+
+        fileIndices.push_back(static_cast<mz_uint>(mz_zip_reader_get_num_files(writeArchive.get())));
+        if (sharedWith != ResourceFileCompressor::NO_SHARED_CONTENT)
+        {
+            std::clog << "\t reusing compressed content for " << archiveEntry << std::endl;
+            AddCopy(archiveEntry, fileIndices[sharedWith], levels[i], modifiedTime);
+        }
+        else
+        {
+            mz_uint levelAndFlags = MZ_NO_COMPRESSION;
+            mz_uint64 uncompressedSize = 0;
+            mz_uint32 crc32 = 0;
+            if (resource->deflated)
+            {
+                levelAndFlags = static_cast<mz_uint>(levels[i]) | MZ_ZIP_FLAG_COMPRESSED_DATA;
+                uncompressedSize = resource->uncompressedSize;
+                crc32 = resource->crc32;
+            }
+            if (!mz_zip_writer_add_mem_ex_v2(writeArchive.get(),
+                                             archiveEntry.c_str(),
+                                             resource->data.data(),
+                                             resource->data.size(),
+                                             NULL,
+                                             0,
+                                             levelAndFlags,
+                                             uncompressedSize,
+                                             crc32,
+                                             &modifiedTime,
+                                             NULL,
+                                             0,
+                                             NULL,
+                                             0))
+            {
+                throw std::runtime_error("Error writing file to archive");
+            }
+            resource.reset();
+        }
+        // add a directory entries for the file path
+        size_t lastPathSeparatorPos = archiveEntry.find("/", 0);
+        while (lastPathSeparatorPos != std::string::npos)
+        {
+            AddDirectory(archiveEntry.substr(0, lastPathSeparatorPos + 1));
+            lastPathSeparatorPos = archiveEntry.find("/", lastPathSeparatorPos + 1);
+        }
+    }
+}
+
+void
+ZipArchive::AddCopy(std::string const& archiveEntry, mz_uint fileIndex, int level, MZ_TIME_T& modifiedTime)
+{
+    mz_zip_archive_file_stat stat;
+    if (!mz_zip_reader_file_stat(writeArchive.get(), fileIndex, &stat))
+    {
+        throw std::runtime_error("Error reading file from archive");
+    }
+    size_t size = 0;
+    std::unique_ptr<void, void (*)(void*)> data(
+        mz_zip_reader_extract_to_heap(writeArchive.get(), fileIndex, &size, MZ_ZIP_FLAG_COMPRESSED_DATA),
+        ::free);
+    if (!data)
+    {
+        throw std::runtime_error("Error reading file from archive");
+    }
+
+    mz_uint levelAndFlags = MZ_NO_COMPRESSION;
+    mz_uint64 uncompressedSize = 0;
+    mz_uint32 crc32 = 0;
+    if (stat.m_method == MZ_DEFLATED)
+    {
+        levelAndFlags = static_cast<mz_uint>(level) | MZ_ZIP_FLAG_COMPRESSED_DATA;
+        uncompressedSize = stat.m_uncomp_size;
+        crc32 = stat.m_crc32;
+    }
+    if (!mz_zip_writer_add_mem_ex_v2(writeArchive.get(),
+                                     archiveEntry.c_str(),
+                                     data.get(),
+                                     size,
+                                     NULL,
+                                     0,
+                                     levelAndFlags,
+                                     uncompressedSize,
+                                     crc32,
+                                     &modifiedTime,
+                                     NULL,
+                                     0,
+                                     NULL,
+                                     0))
+    {
+        throw std::runtime_error("Error writing file to archive");
     }
 }
 
@@ -630,6 +1177,8 @@ enum OptionIndex
     VERBOSE,
     BUNDLENAME,
     COMPRESSIONLEVEL,
+    COMPRESSIONRULE,
+    JOBS,
     OUTFILE,
     RESADD,
     ZIPADD,
@@ -655,6 +1204,18 @@ const option::Descriptor usage[] = {
      "compression-level",  Custom_Arg::Numeric,
      " --compression-level, -c  \tCompression level used for zip. Value range "
      "is 0 to 9. Default value is 6."                                                                     },
+    { COMPRESSIONRULE,
+     0, "R",
+     "compression-rule", Custom_Arg::NonEmpty,
+     " --compression-rule, -R  \tCompression level for resource files matching a "
+     "glob pattern, given as <pattern>=<level>, e.g. \"*.png=0\". The first "
+     "matching rule applies. Files which do not get smaller when compressed "
+     "are always stored uncompressed."                                                                    },
+    {            JOBS,
+     0, "j",
+     "jobs",  Custom_Arg::Numeric,
+     " --jobs, -j  \tNumber of threads used to compress resource files. "
+     "Default value is the number of hardware threads."                                                   },
     {         OUTFILE,
      0, "o",
      "out-file", Custom_Arg::NonEmpty,
@@ -684,8 +1245,8 @@ const option::Descriptor usage[] = {
     {         UNKNOWN,
      0,  "",
      "",     Custom_Arg::None,
-     "\nNote:\n1. Only options --res-add and --zip-add can be specified "
-     "multiple times."                                                                                    },
+     "\nNote:\n1. Only options --res-add, --zip-add and --compression-rule can "
+     "be specified multiple times."                                                                       },
     {         UNKNOWN,
      0,  "",
      "",     Custom_Arg::None,
@@ -849,6 +1410,29 @@ main(int argc, char** argv)
     }
     std::clog << "using compression level " << compressionLevel << std::endl;
 
+    CompressionPolicy compressionPolicy(compressionLevel);
+    for (option::Option* opt = options[COMPRESSIONRULE]; opt; opt = opt->next())
+    {
+        try
+        {
+            compressionPolicy.AddRule(opt->arg);
+        }
+        catch (std::invalid_argument const& ex)
+        {
+            std::cerr << "Error: " << ex.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::clog << "using compression rule " << opt->arg << std::endl;
+    }
+
+    unsigned int jobs = std::max(1u, std::thread::hardware_concurrency());
+    if (options[JOBS])
+    {
+        char* endptr = nullptr;
+        jobs = static_cast<unsigned int>(std::max(1L, strtol(options[JOBS].arg, &endptr, 10)));
+    }
+    std::clog << "using " << jobs << " compression threads" << std::endl;
+
     std::string zipFile;
     bool deleteTempFile = false;
 
@@ -875,7 +1459,7 @@ main(int argc, char** argv)
                 deleteTempFile = true;
             }
 
-            std::unique_ptr<ZipArchive> zipArchive(new ZipArchive(zipFile, compressionLevel, bundleName));
+            std::unique_ptr<ZipArchive> zipArchive(new ZipArchive(zipFile, compressionPolicy, bundleName));
 
             // map of manifest file to its JSON data
             std::unordered_map<std::string, Json::Value> manifests;
@@ -906,9 +1490,7 @@ main(int argc, char** argv)
             {
                 resAddArgs.insert(resopt->arg);
             }
-            std::for_each(std::begin(resAddArgs),
-                          std::end(resAddArgs),
-                          [&zipArchive](std::string const& res) { zipArchive->AddResourceFile(res); });
+            zipArchive->AddResourceFiles(resAddArgs, jobs);
 
             // Merge resources from supplied zip archives. Similar to resource files, In order to
             // produce deterministic zip archives, the files must always be added to it in the same
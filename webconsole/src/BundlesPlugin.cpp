@@ -21,6 +21,8 @@
 =============================================================================*/
 
 #include "BundlesPlugin.h"
+#include "WebConsolePaging.h"
+#include "WebConsoleSnapshot.h"
 
 #include "cppmicroservices/httpservice/ServletContext.h"
 
@@ -32,10 +34,13 @@
 
 #include "cppmicroservices/Bundle.h"
 #include "cppmicroservices/BundleResource.h"
+#include "cppmicroservices/BundleEvent.h"
 #include "cppmicroservices/BundleResourceStream.h"
 #include "cppmicroservices/Constants.h"
 
 #include <cmath>
+#include <map>
+#include <vector>
 
 namespace cppmicroservices
 {
@@ -105,8 +110,96 @@ namespace cppmicroservices
         return ss.str();
     }
 
+    struct BundlesPlugin::BundleIndex
+    {
+        BundleIndex()
+            : bundles(
+                [](std::map<long, Bundle> const& byId)
+                {
+                    std::vector<Bundle> sorted;
+                    sorted.reserve(byId.size());
+                    for (auto const& entry : byId)
+                    {
+                        sorted.push_back(entry.second);
+                    }
+                    return sorted;
+                })
+        {
+        }
+
+        BundleContext context;
+        ListenerToken token;
+
+        // installed bundles by bundle id, read as a list ordered by id
+        WebConsoleSnapshot<std::map<long, Bundle>, std::vector<Bundle>> bundles;
+    };
+
     BundlesPlugin::BundlesPlugin() : SimpleWebConsolePlugin("bundles", "Bundles", "") {}
 
+    BundlesPlugin::~BundlesPlugin()
+    {
+        if (m_Index)
+        {
+            try
+            {
+                m_Index->context.RemoveListener(std::move(m_Index->token));
+            }
+            catch (...)
+            {
+                // the bundle context is no longer valid, the listener
+                // has already been removed by the framework
+            }
+        }
+    }
+
+    std::shared_ptr<BundlesPlugin::BundleIndex>
+    BundlesPlugin::GetIndex()
+    {
+        auto index = std::atomic_load(&m_Index);
+        if (index)
+        {
+            return index;
+        }
+
+        index = std::make_shared<BundleIndex>();
+        index->context = GetContext();
+        // register the listener before the initial scan so that no
+        // installation is missed
+        index->token = index->context.AddBundleListener(
+            [index](BundleEvent const& event)
+            {
+                auto bundle = event.GetBundle();
+                if (event.GetType() == BundleEvent::BUNDLE_INSTALLED)
+                {
+                    index->bundles.Modify([&bundle](std::map<long, Bundle>& byId)
+                                          { byId.emplace(bundle.GetBundleId(), bundle); });
+                }
+                else if (event.GetType() == BundleEvent::BUNDLE_UNINSTALLED)
+                {
+                    index->bundles.Modify([&bundle](std::map<long, Bundle>& byId)
+                                          { byId.erase(bundle.GetBundleId()); });
+                }
+            });
+        auto installed = index->context.GetBundles();
+        index->bundles.Modify(
+            [&installed](std::map<long, Bundle>& byId)
+            {
+                for (auto& bundle : installed)
+                {
+                    byId.emplace(bundle.GetBundleId(), bundle);
+                }
+            });
+
+        // publish the index, unless a concurrent request was faster
+        std::shared_ptr<BundleIndex> published;
+        if (!std::atomic_compare_exchange_strong(&m_Index, &published, index))
+        {
+            index->context.RemoveListener(std::move(index->token));
+            return published;
+        }
+        return index;
+    }
+
     void
     BundlesPlugin::RenderContent(HttpServletRequest& request, HttpServletResponse& response)
     {
@@ -120,7 +213,9 @@ namespace cppmicroservices
 
                 auto& data = std::static_pointer_cast<WebConsoleDefaultVariableResolver>(GetVariableResolver(request))
                                  ->GetData();
-                data["bundles"] = GetBundlesData();
+                TemplateData paging;
+                data["bundles"] = GetBundlesData(request, paging);
+                data["paging"] = std::move(paging);
 
                 BundleResourceStream rs(res, std::ios_base::binary);
                 response.GetOutputStream() << rs.rdbuf();
@@ -221,16 +316,18 @@ namespace cppmicroservices
     }
 
     AbstractWebConsolePlugin::TemplateData
-    BundlesPlugin::GetBundlesData() const
+    BundlesPlugin::GetBundlesData(HttpServletRequest const& request, TemplateData& paging)
     {
         TemplateData data(TemplateData::Type::List);
 
-        auto bundles = GetContext().GetBundles();
-        std::sort(bundles.begin(),
-                  bundles.end(),
-                  [](Bundle const& b1, Bundle const& b2) { return b1.GetBundleId() < b2.GetBundleId(); });
-        for (auto& bundle : bundles)
+        // only the bundles on the requested page are rendered
+        auto const bundles = GetIndex()->bundles.Get();
+        WebConsolePage page(request, bundles->size());
+        paging = page.GetTemplateData();
+
+        for (std::size_t i = page.Begin(); i < page.End(); ++i)
         {
+            auto const& bundle = (*bundles)[i];
             TemplateData entry;
 
             AnyMap const& headers = bundle.GetHeaders();
@@ -25,6 +25,8 @@
 
 #include "cppmicroservices/webconsole/SimpleWebConsolePlugin.h"
 
+#include <memory>
+
 namespace cppmicroservices
 {
 
@@ -32,8 +34,11 @@ namespace cppmicroservices
     {
       public:
         BundlesPlugin();
+        ~BundlesPlugin() override;
 
       private:
+        struct BundleIndex;
+
         enum class RequestType : int
         {
             Unknown = 0,
@@ -46,7 +51,13 @@ namespace cppmicroservices
 
         bool IsHtmlRequest(HttpServletRequest& request);
 
-        TemplateData GetBundlesData() const;
+        /**
+         * Returns the index of installed bundles. The index is created on
+         * first use and kept up to date by a bundle listener.
+         */
+        std::shared_ptr<BundleIndex> GetIndex();
+
+        TemplateData GetBundlesData(HttpServletRequest const& request, TemplateData& paging);
 
         void GetBundleData(long id, TemplateData& data, std::string const& pluginRoot) const;
 
@@ -56,6 +67,8 @@ namespace cppmicroservices
                                                                 std::string& json,
                                                                 int level,
                                                                 std::string const& pluginRoot) const;
+
+        std::shared_ptr<BundleIndex> m_Index;
     };
 } // namespace cppmicroservices
 
@@ -0,0 +1,96 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#include "LocksPlugin.h"
+
+#include "cppmicroservices/webconsole/WebConsoleDefaultVariableResolver.h"
+
+#include "cppmicroservices/httpservice/HttpServletRequest.h"
+#include "cppmicroservices/httpservice/HttpServletResponse.h"
+
+#include "cppmicroservices/Bundle.h"
+#include "cppmicroservices/BundleContext.h"
+#include "cppmicroservices/BundleResource.h"
+#include "cppmicroservices/BundleResourceStream.h"
+#include "cppmicroservices/GetBundleContext.h"
+#include "cppmicroservices/LockProfiler.h"
+
+#include <iomanip>
+#include <sstream>
+
+namespace cppmicroservices
+{
+
+    namespace
+    {
+        std::string
+        ToMicroseconds(std::chrono::nanoseconds ns)
+        {
+            std::ostringstream oss;
+            oss << std::fixed << std::setprecision(1) << std::chrono::duration<double, std::micro>(ns).count();
+            return oss.str();
+        }
+    } // namespace
+
+    LocksPlugin::LocksPlugin() : SimpleWebConsolePlugin("locks", "Locks", "") {}
+
+    void
+    LocksPlugin::RenderContent(HttpServletRequest& request, HttpServletResponse& response)
+    {
+        BundleResource res = GetBundleContext().GetBundle().GetResource("/templates/locks.html");
+        if (res)
+        {
+            auto& data
+                = std::static_pointer_cast<WebConsoleDefaultVariableResolver>(GetVariableResolver(request))->GetData();
+            data["us-lockprofiling"]
+                = LockProfiler::IsEnabled() ? TemplateData::Type::True : TemplateData::Type::False;
+
+            TemplateData locks(TemplateData::Type::List);
+            for (auto const& site : LockProfiler::GetStatistics())
+            {
+                TemplateData lock;
+                lock["name"] = site.name;
+                lock["acquisitions"] = std::to_string(site.acquisitions);
+                lock["contentions"] = std::to_string(site.contentions);
+                lock["wait"] = ToMicroseconds(site.totalWait);
+                lock["waitP50"] = ToMicroseconds(LockProfiler::Percentile(site.waitHistogram, 0.5));
+                lock["waitP99"] = ToMicroseconds(LockProfiler::Percentile(site.waitHistogram, 0.99));
+                lock["waitMax"] = ToMicroseconds(site.maxWait);
+                lock["hold"] = ToMicroseconds(site.totalHold);
+                lock["holdP50"] = ToMicroseconds(LockProfiler::Percentile(site.holdHistogram, 0.5));
+                lock["holdP99"] = ToMicroseconds(LockProfiler::Percentile(site.holdHistogram, 0.99));
+                lock["holdMax"] = ToMicroseconds(site.maxHold);
+                locks << lock;
+            }
+            data["us-locks"] = std::move(locks);
+
+            BundleResourceStream rs(res, std::ios_base::binary);
+            response.GetOutputStream() << rs.rdbuf();
+        }
+    }
+
+    BundleResource
+    LocksPlugin::GetResource(std::string const& path) const
+    {
+        return (this->GetContext()) ? this->GetContext().GetBundle().GetResource(path) : BundleResource();
+    }
+} // namespace cppmicroservices
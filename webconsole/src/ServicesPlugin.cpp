@@ -21,6 +21,8 @@
 =============================================================================*/
 
 #include "ServicesPlugin.h"
+#include "WebConsolePaging.h"
+#include "WebConsoleSnapshot.h"
 
 #include "cppmicroservices/webconsole/WebConsoleDefaultVariableResolver.h"
 
@@ -33,16 +35,143 @@
 #include "cppmicroservices/BundleResourceStream.h"
 #include "cppmicroservices/Constants.h"
 #include "cppmicroservices/GetBundleContext.h"
+#include "cppmicroservices/ServiceEvent.h"
 
+#include <map>
 #include <set>
+#include <vector>
 
 namespace cppmicroservices
 {
 
     std::string NumToString(int64_t val);
 
+    struct ServicesPlugin::ServiceIndex
+    {
+        // interface id -> ids of the services registered under it
+        using Interfaces = std::map<std::string, std::set<long>>;
+
+        ServiceIndex()
+            : interfaces(
+                [](Interfaces const& byInterface)
+                {
+                    std::vector<std::string> ids;
+                    ids.reserve(byInterface.size());
+                    for (auto const& entry : byInterface)
+                    {
+                        ids.push_back(entry.first);
+                    }
+                    return ids;
+                })
+        {
+        }
+
+        void
+        Add(ServiceReferenceBase const& ref)
+        {
+            long id = any_cast<long>(ref.GetProperty(Constants::SERVICE_ID));
+            Any objectClass = ref.GetProperty(Constants::OBJECTCLASS);
+            interfaces.Modify(
+                [id, &objectClass](Interfaces& byInterface)
+                {
+                    for (auto const& iid : ref_any_cast<std::vector<std::string>>(objectClass))
+                    {
+                        byInterface[iid].insert(id);
+                    }
+                });
+        }
+
+        void
+        Remove(ServiceReferenceBase const& ref)
+        {
+            long id = any_cast<long>(ref.GetProperty(Constants::SERVICE_ID));
+            Any objectClass = ref.GetProperty(Constants::OBJECTCLASS);
+            interfaces.Modify(
+                [id, &objectClass](Interfaces& byInterface)
+                {
+                    for (auto const& iid : ref_any_cast<std::vector<std::string>>(objectClass))
+                    {
+                        auto iter = byInterface.find(iid);
+                        if (iter != byInterface.end())
+                        {
+                            iter->second.erase(id);
+                            if (iter->second.empty())
+                            {
+                                byInterface.erase(iter);
+                            }
+                        }
+                    }
+                });
+        }
+
+        BundleContext context;
+        ListenerToken token;
+
+        // registered service interfaces, read as a sorted list of interface ids
+        WebConsoleSnapshot<Interfaces, std::vector<std::string>> interfaces;
+    };
+
     ServicesPlugin::ServicesPlugin() : SimpleWebConsolePlugin("services", "Services", "") {}
 
+    ServicesPlugin::~ServicesPlugin()
+    {
+        if (m_Index)
+        {
+            try
+            {
+                m_Index->context.RemoveListener(std::move(m_Index->token));
+            }
+            catch (...)
+            {
+                // the bundle context is no longer valid, the listener
+                // has already been removed by the framework
+            }
+        }
+    }
+
+    std::shared_ptr<ServicesPlugin::ServiceIndex>
+    ServicesPlugin::GetIndex()
+    {
+        auto index = std::atomic_load(&m_Index);
+        if (index)
+        {
+            return index;
+        }
+
+        index = std::make_shared<ServiceIndex>();
+        index->context = GetContext();
+        // register the listener before the initial scan so that no
+        // registration is missed
+        index->token = index->context.AddServiceListener(
+            [index](ServiceEvent const& event)
+            {
+                if (event.GetType() == ServiceEvent::SERVICE_REGISTERED)
+                {
+                    index->Add(event.GetServiceReference());
+                }
+                else if (event.GetType() == ServiceEvent::SERVICE_UNREGISTERING)
+                {
+                    index->Remove(event.GetServiceReference());
+                }
+            });
+        for (auto const& ref : index->context.GetServiceReferences(""))
+        {
+            if (ref)
+            {
+                index->Add(ref);
+            }
+        }
+
+        // publish the index, unless a concurrent request was faster
+        std::shared_ptr<ServiceIndex> published;
+        if (!std::atomic_compare_exchange_strong(&m_Index, &published, index))
+        {
+            index->context.RemoveListener(std::move(index->token));
+            return published;
+        }
+        return index;
+    }
+
     void
     ServicesPlugin::RenderContent(HttpServletRequest& request, HttpServletResponse& response)
     {
@@ -54,7 +183,9 @@ namespace cppmicroservices
             {
                 auto& data = std::static_pointer_cast<WebConsoleDefaultVariableResolver>(GetVariableResolver(request))
                                  ->GetData();
-                data["services"] = GetIds();
+                TemplateData paging;
+                data["services"] = GetIds(request, paging);
+                data["paging"] = std::move(paging);
 
                 BundleResourceStream rs(res, std::ios_base::binary);
                 response.GetOutputStream() << rs.rdbuf();
@@ -68,8 +199,10 @@ namespace cppmicroservices
             {
                 auto& data = std::static_pointer_cast<WebConsoleDefaultVariableResolver>(GetVariableResolver(request))
                                  ->GetData();
+                TemplateData paging;
                 data["interface"] = id;
-                data["services"] = GetInterface(id);
+                data["services"] = GetInterface(id, request, paging);
+                data["paging"] = std::move(paging);
 
                 BundleResourceStream rs(res, std::ios_base::binary);
                 response.GetOutputStream() << rs.rdbuf();
@@ -78,35 +211,31 @@ namespace cppmicroservices
     }
 
     AbstractWebConsolePlugin::TemplateData
-    ServicesPlugin::GetIds() const
+    ServicesPlugin::GetIds(HttpServletRequest const& request, TemplateData& paging)
     {
-        std::set<std::string> ids;
-        std::vector<ServiceReferenceU> refs = GetContext().GetServiceReferences("");
-        for (auto ref : refs)
-        {
-            Any objectClass = ref.GetProperty(Constants::OBJECTCLASS);
-            auto const& oc = ref_any_cast<std::vector<std::string>>(objectClass);
-            for (auto const& id : oc)
-            {
-                ids.insert(id);
-            }
-        }
+        auto const interfaces = GetIndex()->interfaces.Get();
 
         TemplateData data(TemplateData::Type::List);
-        for (auto const& id : ids)
+        WebConsolePage page(request, interfaces->size());
+        for (std::size_t i = page.Begin(); i < page.End(); ++i)
         {
-            data << TemplateData { "id", id };
+            data << TemplateData { "id", (*interfaces)[i] };
         }
+        paging = page.GetTemplateData();
         return data;
     }
 
     AbstractWebConsolePlugin::TemplateData
-    ServicesPlugin::GetInterface(std::string const& iid) const
+    ServicesPlugin::GetInterface(std::string const& iid, HttpServletRequest const& request, TemplateData& paging) const
     {
         TemplateData data(TemplateData::Type::List);
 
-        for (auto& ref : GetContext().GetServiceReferences(iid))
+        // only the services on the requested page have their properties read
+        auto refs = GetContext().GetServiceReferences(iid);
+        WebConsolePage page(request, refs.size());
+        for (std::size_t i = page.Begin(); i < page.End(); ++i)
         {
+            auto const& ref = refs[i];
             AnyMap props(AnyMap::ORDERED_MAP);
             for (auto const& key : ref.GetPropertyKeys())
             {
@@ -124,6 +253,7 @@ namespace cppmicroservices
 
             data << std::move(entry);
         }
+        paging = page.GetTemplateData();
 
         return data;
     }
@@ -25,6 +25,8 @@
 
 #include "cppmicroservices/webconsole/SimpleWebConsolePlugin.h"
 
+#include <memory>
+
 namespace cppmicroservices
 {
 
@@ -32,12 +34,23 @@ namespace cppmicroservices
     {
       public:
         ServicesPlugin();
+        ~ServicesPlugin() override;
 
       private:
+        struct ServiceIndex;
+
         void RenderContent(HttpServletRequest& /*request*/, HttpServletResponse& response);
 
-        TemplateData GetIds() const;
-        TemplateData GetInterface(std::string const& iid) const;
+        /**
+         * Returns the index of registered service interfaces. The index is
+         * created on first use and kept up to date by a service listener.
+         */
+        std::shared_ptr<ServiceIndex> GetIndex();
+
+        TemplateData GetIds(HttpServletRequest const& request, TemplateData& paging);
+        TemplateData GetInterface(std::string const& iid, HttpServletRequest const& request, TemplateData& paging) const;
+
+        std::shared_ptr<ServiceIndex> m_Index;
     };
 } // namespace cppmicroservices
 
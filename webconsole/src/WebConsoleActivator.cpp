@@ -25,6 +25,7 @@
 #include "cppmicroservices/BundleActivator.h"
 
 #include "BundlesPlugin.h"
+#include "LocksPlugin.h"
 #include "ServicesPlugin.h"
 #include "SettingsPlugin.h"
 
@@ -46,6 +47,7 @@ namespace cppmicroservices
         std::shared_ptr<SettingsPlugin> m_SettingsPlugin;
         std::shared_ptr<ServicesPlugin> m_ServicesPlugin;
         std::shared_ptr<BundlesPlugin> m_BundlesPlugin;
+        std::shared_ptr<LocksPlugin> m_LocksPlugin;
     };
 
     void
@@ -54,6 +56,7 @@ namespace cppmicroservices
         m_SettingsPlugin = std::make_shared<SettingsPlugin>();
         m_ServicesPlugin = std::make_shared<ServicesPlugin>();
         m_BundlesPlugin = std::make_shared<BundlesPlugin>();
+        m_LocksPlugin = std::make_shared<LocksPlugin>();
         m_WebConsoleServlet = std::make_shared<WebConsoleServlet>();
         cppmicroservices::ServiceProperties props;
         props[HttpServlet::PROP_CONTEXT_ROOT] = std::string("/console");
@@ -64,6 +67,7 @@ namespace cppmicroservices
         m_SettingsPlugin->Register();
         m_ServicesPlugin->Register();
         m_BundlesPlugin->Register();
+        m_LocksPlugin->Register();
 
         //  server->addHandler("/Console/bundles/", new BundlesHtml(context));
         //  server->addHandler("/Console/resources/", new ResourcesHtml(context));
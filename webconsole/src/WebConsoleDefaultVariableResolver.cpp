@@ -22,16 +22,108 @@
 
 #include "cppmicroservices/webconsole/WebConsoleDefaultVariableResolver.h"
 
+#include <list>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace cppmicroservices
 {
 
+    namespace
+    {
+        // Upper bound for the number of cached templates. Templates come from
+        // bundle resources, so the cache only fills up if rendered content
+        // itself contains mustache tags.
+        std::size_t const MAX_CACHED_TEMPLATES = 256;
+
+        // Upper bound for the number of idle copies kept per template
+        std::size_t const MAX_IDLE_COPIES = 8;
+
+        class CompiledTemplate
+        {
+          public:
+            explicit CompiledTemplate(std::string const& text) : m_Prototype(text) {}
+
+            // Kainjow::Mustache::render is not const. Each rendering uses its
+            // own copy of the parsed template, so that concurrent renderings
+            // of the same template do not wait for each other.
+            std::string
+            Render(MustacheData const& data)
+            {
+                std::unique_ptr<Kainjow::Mustache> copy;
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    if (!m_Idle.empty())
+                    {
+                        copy = std::move(m_Idle.back());
+                        m_Idle.pop_back();
+                    }
+                }
+                if (!copy)
+                {
+                    copy = std::make_unique<Kainjow::Mustache>(m_Prototype);
+                }
+
+                std::string result = copy->render(data);
+
+                // a failed rendering leaves an error message in the copy
+                if (copy->isValid() == m_Prototype.isValid())
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    if (m_Idle.size() < MAX_IDLE_COPIES)
+                    {
+                        m_Idle.push_back(std::move(copy));
+                    }
+                }
+                return result;
+            }
+
+          private:
+            Kainjow::Mustache const m_Prototype;
+
+            std::mutex m_Mutex;
+            std::vector<std::unique_ptr<Kainjow::Mustache>> m_Idle;
+        };
+
+        std::shared_ptr<CompiledTemplate>
+        GetCompiledTemplate(std::string const& text)
+        {
+            using Entry = std::pair<std::string, std::shared_ptr<CompiledTemplate>>;
+
+            static std::mutex cacheMutex;
+            // most recently used templates first
+            static std::list<Entry> entries;
+            static std::unordered_map<std::string, std::list<Entry>::iterator> cache;
+
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            auto iter = cache.find(text);
+            if (iter != cache.end())
+            {
+                entries.splice(entries.begin(), entries, iter->second);
+                return iter->second->second;
+            }
+
+            // evict the least recently used template only
+            if (cache.size() >= MAX_CACHED_TEMPLATES)
+            {
+                cache.erase(entries.back().first);
+                entries.pop_back();
+            }
+            auto compiled = std::make_shared<CompiledTemplate>(text);
+            entries.emplace_front(text, compiled);
+            cache.emplace(text, entries.begin());
+            return compiled;
+        }
+    } // namespace
+
     std::string
     WebConsoleDefaultVariableResolver::Resolve(std::string const& variable) const
     {
-        Kainjow::Mustache mustache(variable);
-        return mustache.render(m_Data);
+        return GetCompiledTemplate(variable)->Render(m_Data);
     }
 
     MustacheData&
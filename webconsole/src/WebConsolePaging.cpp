@@ -0,0 +1,117 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#include "WebConsolePaging.h"
+
+#include "cppmicroservices/httpservice/HttpServletRequest.h"
+
+#include <algorithm>
+
+namespace cppmicroservices
+{
+
+    std::string NumToString(int64_t val);
+
+    namespace
+    {
+        std::size_t
+        GetQueryParameter(std::string const& query, std::string const& name, std::size_t defaultValue)
+        {
+            std::string::size_type pos = 0;
+            while (pos < query.size())
+            {
+                std::string::size_type end = query.find('&', pos);
+                if (end == std::string::npos)
+                {
+                    end = query.size();
+                }
+                if (query.compare(pos, name.size(), name) == 0 && pos + name.size() < end
+                    && query[pos + name.size()] == '=')
+                {
+                    try
+                    {
+                        return std::stoul(query.substr(pos + name.size() + 1, end - pos - name.size() - 1));
+                    }
+                    catch (std::exception const&)
+                    {
+                        return defaultValue;
+                    }
+                }
+                pos = end + 1;
+            }
+            return defaultValue;
+        }
+    } // namespace
+
+    WebConsolePage::WebConsolePage(HttpServletRequest const& request, std::size_t totalCount)
+        : index(1)
+        , size(DEFAULT_SIZE)
+        , pageCount(1)
+        , totalCount(totalCount)
+    {
+        std::string query = request.GetQueryString();
+        size = std::min(std::max(GetQueryParameter(query, "size", DEFAULT_SIZE), std::size_t(1)), MAX_SIZE);
+        pageCount = std::max((totalCount + size - 1) / size, std::size_t(1));
+        index = std::min(std::max(GetQueryParameter(query, "page", 1), std::size_t(1)), pageCount);
+    }
+
+    std::size_t
+    WebConsolePage::Begin() const
+    {
+        return std::min((index - 1) * size, totalCount);
+    }
+
+    std::size_t
+    WebConsolePage::End() const
+    {
+        return std::min(index * size, totalCount);
+    }
+
+    AbstractWebConsolePlugin::TemplateData
+    WebConsolePage::GetTemplateData() const
+    {
+        using TemplateData = AbstractWebConsolePlugin::TemplateData;
+
+        TemplateData data;
+        data["page"] = NumToString(static_cast<int64_t>(index));
+        data["pages"] = NumToString(static_cast<int64_t>(pageCount));
+        data["size"] = NumToString(static_cast<int64_t>(size));
+        data["total"] = NumToString(static_cast<int64_t>(totalCount));
+        if (index > 1)
+        {
+            data["prev"] = NumToString(static_cast<int64_t>(index - 1));
+        }
+        else
+        {
+            data["prev"] = TemplateData::Type::False;
+        }
+        if (index < pageCount)
+        {
+            data["next"] = NumToString(static_cast<int64_t>(index + 1));
+        }
+        else
+        {
+            data["next"] = TemplateData::Type::False;
+        }
+        return data;
+    }
+} // namespace cppmicroservices
@@ -0,0 +1,61 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#ifndef CPPMICROSERVICES_WEBCONSOLEPAGING_H
+#define CPPMICROSERVICES_WEBCONSOLEPAGING_H
+
+#include "cppmicroservices/webconsole/AbstractWebConsolePlugin.h"
+
+#include <cstddef>
+#include <string>
+
+namespace cppmicroservices
+{
+
+    class HttpServletRequest;
+
+    /**
+     * A page of a list view, selected by the "page" and "size" query
+     * parameters of a request.
+     */
+    struct WebConsolePage
+    {
+        static constexpr std::size_t DEFAULT_SIZE = 100;
+        static constexpr std::size_t MAX_SIZE = 1000;
+
+        WebConsolePage(HttpServletRequest const& request, std::size_t totalCount);
+
+        // zero based index of the first and one past the last entry of this page
+        std::size_t Begin() const;
+        std::size_t End() const;
+
+        // paging data for the "paging" section of the list templates
+        AbstractWebConsolePlugin::TemplateData GetTemplateData() const;
+
+        std::size_t index; // one based page number
+        std::size_t size;
+        std::size_t pageCount;
+        std::size_t totalCount;
+    };
+} // namespace cppmicroservices
+
+#endif // CPPMICROSERVICES_WEBCONSOLEPAGING_H
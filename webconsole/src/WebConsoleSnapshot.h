@@ -0,0 +1,107 @@
+/*=============================================================================
+
+  Library: CppMicroServices
+
+  Copyright (c) The CppMicroServices developers. See the COPYRIGHT
+  file at the top-level directory of this distribution and at
+  https://github.com/CppMicroServices/CppMicroServices/COPYRIGHT .
+
+  Licensed under the Apache License, Version 2.0 (the "License");
+  you may not use this file except in compliance with the License.
+  You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+=============================================================================*/
+
+#ifndef CPPMICROSERVICES_WEBCONSOLESNAPSHOT_H
+#define CPPMICROSERVICES_WEBCONSOLESNAPSHOT_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace cppmicroservices
+{
+
+    /**
+     * A value which framework listeners update entry by entry, and which
+     * concurrent requests read through immutable snapshots.
+     *
+     * Modify changes the current value in place. Get returns a snapshot of
+     * type View, built from the current value on the first read after a
+     * change and published with an atomic shared_ptr swap. Callers render
+     * from the snapshot without holding any lock.
+     */
+    template <typename T, typename View>
+    class WebConsoleSnapshot
+    {
+      public:
+        explicit WebConsoleSnapshot(std::function<View(T const&)> makeView)
+            : m_MakeView(std::move(makeView))
+            , m_Version(0)
+        {
+        }
+
+        template <typename Func>
+        void
+        Modify(Func&& func)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            std::forward<Func>(func)(m_Value);
+            m_Version.fetch_add(1, std::memory_order_release);
+        }
+
+        std::shared_ptr<View const>
+        Get()
+        {
+            auto snapshot = std::atomic_load(&m_Snapshot);
+            if (snapshot && snapshot->version == m_Version.load(std::memory_order_acquire))
+            {
+                return std::shared_ptr<View const>(snapshot, &snapshot->view);
+            }
+
+            std::shared_ptr<Snapshot const> fresh;
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                fresh = std::make_shared<Snapshot const>(m_Version.load(std::memory_order_relaxed),
+                                                         m_MakeView(m_Value));
+            }
+
+            // never replace a snapshot built by a concurrent reader from a newer value
+            while ((!snapshot || snapshot->version < fresh->version)
+                   && !std::atomic_compare_exchange_weak(&m_Snapshot, &snapshot, fresh))
+            {
+            }
+            return std::shared_ptr<View const>(fresh, &fresh->view);
+        }
+
+      private:
+        struct Snapshot
+        {
+            Snapshot(std::uint64_t v, View&& vw) : version(v), view(std::move(vw)) {}
+
+            std::uint64_t const version;
+            View const view;
+        };
+
+        std::function<View(T const&)> const m_MakeView;
+
+        std::mutex m_Mutex;
+        T m_Value;
+        std::atomic<std::uint64_t> m_Version;
+
+        std::shared_ptr<Snapshot const> m_Snapshot;
+    };
+} // namespace cppmicroservices
+
+#endif // CPPMICROSERVICES_WEBCONSOLESNAPSHOT_H